@@ -0,0 +1,847 @@
+﻿#pragma once
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <ctime>
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <condition_variable>
+
+#include "Log.hpp"
+
+#if defined(SPDLOG_FMT_EXTERNAL)
+#include <fmt/args.h>
+#else
+#include <spdlog/fmt/bundled/args.h>
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define CORE_BLOG_HAS_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CORE_BLOG_HAS_TSC 1
+#else
+#define CORE_BLOG_HAS_TSC 0
+#endif
+
+// 포맷을 미루는 바이너리 로그
+// 호출 스레드는 호출 위치 ID 와 인자 바이트만 스레드별 링 버퍼에 복사하고, 포맷은 writer 스레드나 오프라인 디코더가 한다
+//
+// CORE_BLOG_INFO(Graphics, "{} draws, {:.2f} ms", drawCount, gpuMs);
+//
+// 파일 형식 (little endian, 정렬 없음)
+//  - 머리: "CBLG" + uint32 버전
+//  - 'S' 블록: uint32 id, uint8 category, uint8 level, uint32 line, uint32 길이 + format, uint32 길이 + file
+//  - 'R' 블록: BinaryRecordHeader + 인자들 (uint8 타입 + 값, 문자열은 uint32 길이 + 바이트)
+//  'S' 블록은 그 ID 를 쓰는 첫 'R' 블록보다 항상 앞에 온다
+namespace core
+{
+    struct BinaryLogConfig
+    {
+        std::string               filePath = "logs/engine.blog";
+        size_t                    bufferSize = 64 * 1024;   // 스레드당 링 버퍼 (2의 거듭제곱으로 올림). 가득 차면 버린다
+        std::chrono::milliseconds pollInterval{ 10 };       // writer 스레드가 버퍼를 비우는 주기
+        bool                      echoToText = false;       // writer 스레드에서 포맷해 core::Log 에도 기록 (개발용)
+    };
+
+    // 디코더가 레코드마다 돌려주는 정보 (문자열은 콜백 동안만 유효)
+    struct BinaryLogEntry
+    {
+        LogCategory               category = LogCategory::Core;
+        spdlog::level::level_enum level = spdlog::level::info;
+        int64_t                   timestamp = 0;    // system_clock 기준 ns
+        std::string_view          format;
+        std::string_view          file;
+        uint32_t                  line = 0;
+        std::string_view          text;
+    };
+
+    namespace internal
+    {
+        enum class BinaryArgType : uint8_t
+        {
+            Int64,
+            UInt64,
+            Double,
+            Bool,
+            Char,
+            String,
+            Pointer
+        };
+
+        constexpr char     BinaryLogMagic[4] = { 'C', 'B', 'L', 'G' };
+        constexpr uint32_t BinaryLogVersion = 1;
+        constexpr uint8_t  BinaryLogSiteBlock = 'S';
+        constexpr uint8_t  BinaryLogRecordBlock = 'R';
+
+        // 호출 위치 하나. format/file 은 리터럴이므로 view 로 충분하다
+        struct BinaryLogSite
+        {
+            std::string_view          format;
+            std::string_view          file;
+            uint32_t                  line = 0;
+            LogCategory               category = LogCategory::Core;
+            spdlog::level::level_enum level = spdlog::level::info;
+        };
+
+        // 링 버퍼/파일 안 레코드 머리. siteId 0 은 버퍼 끝을 건너뛰는 패딩 (size, siteId 만 유효)
+        struct BinaryRecordHeader
+        {
+            uint32_t size;      // 머리 포함, 정렬 패딩 제외
+            uint32_t siteId;
+            int64_t  timestamp; // 링 버퍼에서는 ReadBinaryLogTicks 값, 파일에서는 system_clock 기준 ns
+        };
+
+        // 호출 스레드가 읽는 시각. system_clock 보다 싼 TSC (x86 이 아니면 steady_clock)
+        // writer 스레드가 BinaryLogTimeBase 로 system_clock ns 로 바꿔 파일에 쓴다
+        inline int64_t ReadBinaryLogTicks()
+        {
+#if CORE_BLOG_HAS_TSC
+            return static_cast<int64_t>(__rdtsc());
+#else
+            return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+        }
+
+        inline int64_t ReadBinaryLogSystemNs()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(spdlog::log_clock::now().time_since_epoch()).count();
+        }
+
+        // 틱과 system_clock 을 같은 순간에 읽은 쌍
+        // Init 때의 쌍과 변환 직전의 쌍 사이를 선형 보간하므로 틱 주파수를 따로 잴 필요가 없다
+        struct BinaryLogTimeBase
+        {
+            int64_t ticks = 0;
+            int64_t ns = 0;
+
+            static BinaryLogTimeBase Now() { return { ReadBinaryLogTicks(), ReadBinaryLogSystemNs() }; }
+        };
+
+        // 로그를 쓰는 스레드 하나와 writer 스레드 사이의 SPSC 바이트 링
+        // 레코드는 8바이트 정렬로 연속 배치하고, 끝에 들어가지 않으면 패딩을 두고 처음으로 돌아간다
+        struct BinaryLogBuffer
+        {
+            explicit BinaryLogBuffer(size_t capacity);
+
+            // 쓰는 스레드 전용. 자리가 없으면 nullptr
+            std::byte* TryReserve(size_t size);
+            void       Commit() { tail.store(reservedTail, std::memory_order_release); }
+
+            std::unique_ptr<std::byte[]> data;
+            size_t                       mask = 0;
+            uint64_t                     reservedTail = 0;  // 쓰는 스레드 전용
+            uint64_t                     cachedHead = 0;    // 쓰는 스레드 전용 (head 를 매번 읽지 않도록)
+
+            alignas(64) std::atomic<uint64_t> head{ 0 };
+            alignas(64) std::atomic<uint64_t> tail{ 0 };
+            std::atomic<bool>                 retired{ false }; // 스레드 종료. 다 비우면 writer 가 해제
+        };
+
+        // thread_local 슬롯. 스레드가 끝나면 버퍼를 은퇴시킨다
+        struct BinaryLogThreadBuffer
+        {
+            ~BinaryLogThreadBuffer();
+
+            std::shared_ptr<BinaryLogBuffer> buffer;
+            uint32_t                         generation = 0;    // BinaryLog::Init 마다 증가 (이전 세션의 버퍼는 다시 등록)
+        };
+
+        struct BinaryLogShutdownGuard
+        {
+            ~BinaryLogShutdownGuard();
+        };
+
+        template<typename T>
+        constexpr BinaryArgType GetBinaryArgType()
+        {
+            using U = std::remove_cv_t<std::remove_reference_t<T>>;
+            if constexpr (std::is_same_v<U, bool>)
+                return BinaryArgType::Bool;
+            else if constexpr (std::is_same_v<U, char>)
+                return BinaryArgType::Char;
+            else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+                return BinaryArgType::Int64;
+            else if constexpr (std::is_integral_v<U>)
+                return BinaryArgType::UInt64;
+            else if constexpr (std::is_floating_point_v<U>)
+                return BinaryArgType::Double;
+            else if constexpr (std::is_convertible_v<const U&, std::string_view>)
+                return BinaryArgType::String;
+            else if constexpr (std::is_pointer_v<U> || std::is_null_pointer_v<U>)
+                return BinaryArgType::Pointer;
+            else
+                static_assert(sizeof(U) == 0, "BinaryLog: 정수/실수/bool/char/문자열/포인터 인자만 지원");
+        }
+
+        // 문자열 인자. null const char* 는 std::string_view 로 만들 수 없으므로 "(null)" 로 기록
+        template<typename T>
+        std::string_view GetBinaryStringArg(const T& arg)
+        {
+            if constexpr (std::is_pointer_v<std::remove_cv_t<std::remove_reference_t<T>>>)
+                return arg ? std::string_view(arg) : std::string_view("(null)");
+            else
+                return std::string_view(arg);
+        }
+
+        template<typename T>
+        size_t GetEncodedArgSize(const T& arg)
+        {
+            constexpr BinaryArgType type = GetBinaryArgType<T>();
+            if constexpr (type == BinaryArgType::String)
+                return 1 + sizeof(uint32_t) + GetBinaryStringArg(arg).size();
+            else if constexpr (type == BinaryArgType::Bool || type == BinaryArgType::Char)
+                return 1 + 1;
+            else
+                return 1 + 8;
+        }
+
+        template<typename T>
+        std::byte* EncodeArg(std::byte* out, const T& arg)
+        {
+            constexpr BinaryArgType type = GetBinaryArgType<T>();
+            *out++ = static_cast<std::byte>(type);
+
+            if constexpr (type == BinaryArgType::String)
+            {
+                const std::string_view str = GetBinaryStringArg(arg);
+                const uint32_t length = static_cast<uint32_t>(str.size());
+                std::memcpy(out, &length, sizeof(length));
+                std::memcpy(out + sizeof(length), str.data(), str.size());
+                return out + sizeof(length) + str.size();
+            }
+            else if constexpr (type == BinaryArgType::Bool || type == BinaryArgType::Char)
+            {
+                *out = static_cast<std::byte>(arg);
+                return out + 1;
+            }
+            else
+            {
+                if constexpr (type == BinaryArgType::Int64) { const int64_t v = static_cast<int64_t>(arg); std::memcpy(out, &v, 8); }
+                else if constexpr (type == BinaryArgType::UInt64) { const uint64_t v = static_cast<uint64_t>(arg); std::memcpy(out, &v, 8); }
+                else if constexpr (type == BinaryArgType::Double) { const double v = static_cast<double>(arg); std::memcpy(out, &v, 8); }
+                else { const uint64_t v = reinterpret_cast<uintptr_t>(static_cast<const void*>(arg)); std::memcpy(out, &v, 8); }
+                return out + 8;
+            }
+        }
+
+        // 인자 바이트를 해석해 format 으로 포맷. 인자가 잘렸거나 format 과 맞지 않으면 false (out 에는 format 원문)
+        bool FormatBinaryArgs(std::string_view format, const std::byte* args, size_t size, fmt::memory_buffer& out);
+
+        // spdlog 패턴 "[%T] [%n] [%l] %v" 과 같은 한 줄
+        void FormatBinaryLogLine(const BinaryLogEntry& entry, fmt::memory_buffer& out);
+    }
+
+    class BinaryLog
+    {
+    public:
+        // 파일을 열 수 없으면 false
+        static bool Init(const BinaryLogConfig& config = {});
+        // 남은 레코드를 모두 기록하고 writer 스레드를 종료 (다른 스레드가 더 이상 로그를 쓰지 않을 때 호출)
+        // echoToText 면 Log::Shutdown 보다 먼저 불러야 한다. 정적 소멸 시의 자동 Shutdown 은 텍스트 echo 를 하지 않는다
+        static void Shutdown();
+
+        static bool IsEnabled() { return s_Enabled.load(std::memory_order_relaxed); }
+        // 링 버퍼가 가득 차서 버려진 레코드 수
+        static uint64_t GetDroppedCount() { return s_Dropped.load(std::memory_order_relaxed); }
+
+        // CORE_BLOG_* 매크로 전용. site 는 호출 위치마다 하나인 정적 변수 (0 이면 첫 호출에서 등록)
+        template<typename... Args>
+        static void Write(std::atomic<uint32_t>& site, LogCategory category, spdlog::level::level_enum level,
+                          const char* file, uint32_t line, fmt::format_string<Args...> fmt, Args&&... args);
+
+    private:
+        friend struct internal::BinaryLogShutdownGuard;
+
+        static uint32_t                   registerSite(std::atomic<uint32_t>& site, const internal::BinaryLogSite& info);
+        static internal::BinaryLogBuffer* getThreadBuffer();
+        static void                       writerLoop();
+
+        static inline std::mutex                                           s_Mutex;     // s_Sites, s_Buffers
+        static inline std::vector<internal::BinaryLogSite>                 s_Sites;     // id - 1 로 접근. Init/Shutdown 과 무관하게 유지
+        static inline std::vector<std::shared_ptr<internal::BinaryLogBuffer>> s_Buffers;
+        static inline std::atomic<bool>                                    s_Enabled{ false };
+        static inline std::atomic<uint32_t>                                s_Generation{ 0 };
+        static inline std::atomic<uint64_t>                                s_Dropped{ 0 };
+        static inline internal::BinaryLogTimeBase                          s_TimeBase;  // Init 시점. writer 스레드만 읽는다
+        static inline size_t                                               s_BufferSize = 64 * 1024;
+        static inline std::chrono::milliseconds                            s_PollInterval{ 10 };
+        static inline std::atomic<bool>                                    s_EchoToText{ false };   // writer 스레드가 읽는다. 정적 소멸 시 guard 가 끈다
+        static inline std::FILE*                                           s_File = nullptr;
+        static inline std::condition_variable                              s_WakeCv;
+        static inline std::thread                                          s_WriterThread;
+        static inline thread_local internal::BinaryLogThreadBuffer         s_ThreadBuffer;
+        static inline internal::BinaryLogShutdownGuard                     s_ShutdownGuard; // s_WriterThread 보다 먼저 파괴되도록 뒤에 선언
+    };
+
+    // 바이너리 로그 파일을 텍스트로 되돌리는 디코더 (오프라인 도구는 DecodeToText 를 호출하기만 하면 된다)
+    class BinaryLogReader
+    {
+    public:
+        // 레코드마다 fn(const BinaryLogEntry&) 호출. 형식이 잘못되었거나 파일이 잘렸으면 그 지점에서 false
+        template<typename Fn>
+        static bool Read(std::istream& in, Fn&& fn);
+
+        static bool DecodeToText(std::istream& in, std::ostream& out);
+        static bool DecodeToText(const std::string& binaryPath, const std::string& textPath);
+    };
+
+#pragma region IMPLEMENTS
+    namespace internal
+    {
+        inline BinaryLogBuffer::BinaryLogBuffer(size_t capacity)
+        {
+            // 2의 거듭제곱으로 올림
+            size_t size = 1024;
+            while (size < capacity) size <<= 1;
+
+            data = std::make_unique<std::byte[]>(size);
+            mask = size - 1;
+        }
+
+        inline std::byte* BinaryLogBuffer::TryReserve(size_t size)
+        {
+            const size_t capacity = mask + 1;
+            const size_t aligned = (size + 7) & ~size_t{ 7 };
+            const uint64_t tailPos = tail.load(std::memory_order_relaxed);
+            const size_t offset = static_cast<size_t>(tailPos & mask);
+            const size_t contiguous = capacity - offset;
+            const size_t padding = contiguous < aligned ? contiguous : 0;
+            const size_t needed = padding + aligned;
+
+            if (needed > capacity)
+                return nullptr;     // 이 버퍼로는 담을 수 없는 크기
+
+            if (tailPos + needed - cachedHead > capacity)
+            {
+                cachedHead = head.load(std::memory_order_acquire);
+                if (tailPos + needed - cachedHead > capacity)
+                    return nullptr;
+            }
+
+            if (padding)
+            {
+                // 오프셋은 항상 8의 배수라 패딩 머리(size, siteId)는 반드시 들어간다
+                const uint32_t marker[2] = { static_cast<uint32_t>(padding), 0 };
+                std::memcpy(data.get() + offset, marker, sizeof(marker));
+            }
+
+            reservedTail = tailPos + needed;
+            return data.get() + (padding ? 0 : offset);
+        }
+
+        inline BinaryLogThreadBuffer::~BinaryLogThreadBuffer()
+        {
+            if (buffer)
+                buffer->retired.store(true, std::memory_order_release);
+        }
+
+        inline BinaryLogShutdownGuard::~BinaryLogShutdownGuard()
+        {
+            // 정적 소멸 중에는 Log 의 정적 변수가 이미 파괴되었을 수 있으므로 마지막 비우기는 파일에만 쓴다
+            BinaryLog::s_EchoToText.store(false, std::memory_order_relaxed);
+            BinaryLog::Shutdown();
+        }
+
+        inline bool FormatBinaryArgs(std::string_view format, const std::byte* args, size_t size, fmt::memory_buffer& out)
+        {
+            fmt::dynamic_format_arg_store<fmt::format_context> store;
+            const std::byte* p = args;
+            const std::byte* end = args + size;
+
+            auto fail = [&]()
+            {
+                out.append(format.data(), format.data() + format.size());
+                return false;
+            };
+
+            while (p < end)
+            {
+                const BinaryArgType type = static_cast<BinaryArgType>(*p++);
+                if (type == BinaryArgType::String)
+                {
+                    uint32_t length = 0;
+                    if (end - p < static_cast<ptrdiff_t>(sizeof(length))) return fail();
+                    std::memcpy(&length, p, sizeof(length));
+                    p += sizeof(length);
+                    if (end - p < static_cast<ptrdiff_t>(length)) return fail();
+                    // 레코드 바이트가 포맷이 끝날 때까지 살아 있으므로 복사하지 않는다
+                    store.push_back(fmt::string_view(reinterpret_cast<const char*>(p), length));
+                    p += length;
+                }
+                else if (type == BinaryArgType::Bool || type == BinaryArgType::Char)
+                {
+                    if (end - p < 1) return fail();
+                    if (type == BinaryArgType::Bool)
+                        store.push_back(*p != std::byte{ 0 });
+                    else
+                        store.push_back(static_cast<char>(*p));
+                    p += 1;
+                }
+                else
+                {
+                    if (end - p < 8) return fail();
+                    switch (type)
+                    {
+                    case BinaryArgType::Int64:  { int64_t v;  std::memcpy(&v, p, 8); store.push_back(v); break; }
+                    case BinaryArgType::UInt64: { uint64_t v; std::memcpy(&v, p, 8); store.push_back(v); break; }
+                    case BinaryArgType::Double: { double v;   std::memcpy(&v, p, 8); store.push_back(v); break; }
+                    case BinaryArgType::Pointer:
+                    {
+                        uint64_t v; std::memcpy(&v, p, 8);
+                        store.push_back(reinterpret_cast<const void*>(static_cast<uintptr_t>(v)));
+                        break;
+                    }
+                    default: return fail();
+                    }
+                    p += 8;
+                }
+            }
+
+            const size_t start = out.size();
+            try
+            {
+                fmt::vformat_to(fmt::appender(out), fmt::string_view(format.data(), format.size()), store);
+            }
+            catch (const fmt::format_error&)
+            {
+                out.resize(start);
+                return fail();
+            }
+            return true;
+        }
+
+        inline void FormatBinaryLogLine(const BinaryLogEntry& entry, fmt::memory_buffer& out)
+        {
+            const std::time_t seconds = static_cast<std::time_t>(entry.timestamp / 1'000'000'000);
+            const std::tm tm = spdlog::details::os::localtime(seconds);
+            const spdlog::string_view_t level = spdlog::level::to_string_view(entry.level);
+            const std::string_view category = GetLogCategoryName(entry.category);
+
+            fmt::format_to(fmt::appender(out), "[{:02}:{:02}:{:02}] [{}] [{}] {}\n",
+                           tm.tm_hour, tm.tm_min, tm.tm_sec,
+                           fmt::string_view(category.data(), category.size()), level,
+                           fmt::string_view(entry.text.data(), entry.text.size()));
+        }
+    }
+
+    inline bool BinaryLog::Init(const BinaryLogConfig& config)
+    {
+        Shutdown();
+
+        ScopedMemoryTag memoryTag(MemoryTag::Logging);
+
+        spdlog::details::os::create_dir(spdlog::details::os::dir_name(config.filePath));
+        std::FILE* file = nullptr;
+        if (spdlog::details::os::fopen_s(&file, config.filePath, "wb"))
+            return false;
+
+        std::fwrite(internal::BinaryLogMagic, 1, sizeof(internal::BinaryLogMagic), file);
+        std::fwrite(&internal::BinaryLogVersion, sizeof(internal::BinaryLogVersion), 1, file);
+
+        s_File = file;
+        s_BufferSize = config.bufferSize;
+        s_PollInterval = config.pollInterval;
+        s_EchoToText.store(config.echoToText, std::memory_order_relaxed);
+        Log::s_BinaryEcho.store(config.echoToText, std::memory_order_release);
+
+        s_TimeBase = internal::BinaryLogTimeBase::Now();
+
+        // 이전 세션에 만들어진 스레드 버퍼는 다음 Write 에서 새로 등록된다
+        s_Generation.fetch_add(1, std::memory_order_release);
+        s_Enabled.store(true, std::memory_order_release);
+        s_WriterThread = std::thread(&BinaryLog::writerLoop);
+        return true;
+    }
+
+    inline void BinaryLog::Shutdown()
+    {
+        if (!s_Enabled.exchange(false, std::memory_order_acq_rel))
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            s_WakeCv.notify_one();
+        }
+        if (s_WriterThread.joinable())
+            s_WriterThread.join();
+
+        {
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            s_Buffers.clear();
+        }
+
+        std::fclose(s_File);
+        s_File = nullptr;
+        Log::s_BinaryEcho.store(false, std::memory_order_release);
+    }
+
+    template<typename... Args>
+    void BinaryLog::Write(std::atomic<uint32_t>& site, LogCategory category, spdlog::level::level_enum level,
+                          const char* file, uint32_t line, fmt::format_string<Args...> fmt, Args&&... args)
+    {
+        if (!IsEnabled())
+            return;
+
+        uint32_t id = site.load(std::memory_order_acquire);
+        if (id == 0)
+        {
+            const fmt::string_view format = fmt.get();
+            id = registerSite(site, { std::string_view(format.data(), format.size()), file, line, category, level });
+        }
+
+        const size_t size = sizeof(internal::BinaryRecordHeader) + (size_t{ 0 } + ... + internal::GetEncodedArgSize(args));
+
+        internal::BinaryLogBuffer* buffer = getThreadBuffer();
+        if (!buffer)
+            return;     // 그 사이 Shutdown 됨
+
+        std::byte* out = buffer->TryReserve(size);
+        if (!out)
+        {
+            s_Dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        internal::BinaryRecordHeader header;
+        header.size = static_cast<uint32_t>(size);
+        header.siteId = id;
+        header.timestamp = internal::ReadBinaryLogTicks();
+        std::memcpy(out, &header, sizeof(header));
+        out += sizeof(header);
+
+        ((out = internal::EncodeArg(out, args)), ...);
+        buffer->Commit();
+    }
+
+    inline uint32_t BinaryLog::registerSite(std::atomic<uint32_t>& site, const internal::BinaryLogSite& info)
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        uint32_t id = site.load(std::memory_order_relaxed);
+        if (id == 0)
+        {
+            ScopedMemoryTag memoryTag(MemoryTag::Logging);
+            s_Sites.push_back(info);
+            id = static_cast<uint32_t>(s_Sites.size());
+            site.store(id, std::memory_order_release);
+        }
+        return id;
+    }
+
+    inline internal::BinaryLogBuffer* BinaryLog::getThreadBuffer()
+    {
+        internal::BinaryLogThreadBuffer& slot = s_ThreadBuffer;
+        const uint32_t generation = s_Generation.load(std::memory_order_acquire);
+        if (slot.buffer && slot.generation == generation)
+            return slot.buffer.get();
+
+        ScopedMemoryTag memoryTag(MemoryTag::Logging);
+        auto buffer = std::make_shared<internal::BinaryLogBuffer>(s_BufferSize);
+        {
+            // Write 의 IsEnabled 확인 뒤에 Shutdown 이 s_Buffers 를 비웠을 수 있다. 그러면 아무도 비우지 않을 버퍼를 등록하지 않는다
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            if (!IsEnabled())
+                return nullptr;
+            s_Buffers.push_back(buffer);
+        }
+
+        if (slot.buffer)
+            slot.buffer->retired.store(true, std::memory_order_release);
+        slot.buffer = std::move(buffer);
+        slot.generation = generation;
+        return slot.buffer.get();
+    }
+
+    inline void BinaryLog::writerLoop()
+    {
+        ScopedMemoryTag memoryTag(MemoryTag::Logging);
+        SetCurrentThreadName("BinaryLogWriter");
+
+        std::vector<internal::BinaryLogSite>                  sites;    // 파일에 기록한 호출 위치 (s_Sites 의 앞부분 복사본)
+        std::vector<std::shared_ptr<internal::BinaryLogBuffer>> buffers;
+        fmt::memory_buffer                                    text;
+
+        // 아직 파일에 없는 호출 위치를 id 까지 기록
+        auto writeSites = [&](uint32_t id)
+        {
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            while (sites.size() < id)
+            {
+                const internal::BinaryLogSite& site = s_Sites[sites.size()];
+                sites.push_back(site);
+
+                const uint32_t siteId = static_cast<uint32_t>(sites.size());
+                const uint8_t category = static_cast<uint8_t>(site.category);
+                const uint8_t level = static_cast<uint8_t>(site.level);
+                const uint32_t formatLength = static_cast<uint32_t>(site.format.size());
+                const uint32_t fileLength = static_cast<uint32_t>(site.file.size());
+
+                std::fputc(internal::BinaryLogSiteBlock, s_File);
+                std::fwrite(&siteId, sizeof(siteId), 1, s_File);
+                std::fwrite(&category, 1, 1, s_File);
+                std::fwrite(&level, 1, 1, s_File);
+                std::fwrite(&site.line, sizeof(site.line), 1, s_File);
+                std::fwrite(&formatLength, sizeof(formatLength), 1, s_File);
+                std::fwrite(site.format.data(), 1, site.format.size(), s_File);
+                std::fwrite(&fileLength, sizeof(fileLength), 1, s_File);
+                std::fwrite(site.file.data(), 1, site.file.size(), s_File);
+            }
+        };
+
+        // 이번 패스의 틱 -> ns 변환 (Init 시점과 지금 사이를 보간)
+        const internal::BinaryLogTimeBase base = s_TimeBase;
+        double nsPerTick = 1.0;
+
+        auto drain = [&](internal::BinaryLogBuffer& buffer)
+        {
+            uint64_t head = buffer.head.load(std::memory_order_relaxed);
+            const uint64_t tail = buffer.tail.load(std::memory_order_acquire);
+            size_t count = 0;
+
+            while (head < tail)
+            {
+                std::byte* record = buffer.data.get() + (head & buffer.mask);
+                uint32_t marker[2];
+                std::memcpy(marker, record, sizeof(marker));
+
+                const uint32_t size = marker[0];
+                const uint32_t siteId = marker[1];
+                if (siteId == 0)
+                {
+                    head += size;
+                    continue;
+                }
+
+                if (siteId > sites.size())
+                    writeSites(siteId);
+
+                // head 를 넘기기 전까지 이 레코드는 writer 것이므로 제자리에서 시각을 바꾼다
+                int64_t ticks;
+                std::memcpy(&ticks, record + offsetof(internal::BinaryRecordHeader, timestamp), sizeof(ticks));
+                const int64_t ns = base.ns + static_cast<int64_t>(static_cast<double>(ticks - base.ticks) * nsPerTick);
+                std::memcpy(record + offsetof(internal::BinaryRecordHeader, timestamp), &ns, sizeof(ns));
+
+                std::fputc(internal::BinaryLogRecordBlock, s_File);
+                std::fwrite(record, 1, size, s_File);
+
+                if (s_EchoToText.load(std::memory_order_relaxed))
+                {
+                    internal::BinaryRecordHeader header;
+                    std::memcpy(&header, record, sizeof(header));
+                    const internal::BinaryLogSite& site = sites[siteId - 1];
+
+                    text.clear();
+                    internal::FormatBinaryArgs(site.format, record + sizeof(header), size - sizeof(header), text);
+                    const auto time = spdlog::log_clock::time_point(std::chrono::duration_cast<spdlog::log_clock::duration>(std::chrono::nanoseconds(header.timestamp)));
+                    Log::Write(site.category, site.level, std::string_view(text.data(), text.size()), time);
+                }
+
+                head += (size + 7) & ~uint64_t{ 7 };
+                ++count;
+            }
+
+            buffer.head.store(head, std::memory_order_release);
+            return count;
+        };
+
+        for (;;)
+        {
+            // 먼저 읽어 두어야 Shutdown 이후 마지막 한 번을 더 비운다
+            const bool running = s_Enabled.load(std::memory_order_acquire);
+
+            {
+                std::lock_guard<std::mutex> lock(s_Mutex);
+                buffers = s_Buffers;
+            }
+
+            const internal::BinaryLogTimeBase now = internal::BinaryLogTimeBase::Now();
+            if (now.ticks > base.ticks)
+                nsPerTick = static_cast<double>(now.ns - base.ns) / static_cast<double>(now.ticks - base.ticks);
+
+            size_t written = 0;
+            for (auto& buffer : buffers)
+            {
+                // 은퇴 확인을 먼저 해야 마지막 레코드까지 비운 뒤에 제거할 수 있다
+                const bool retired = buffer->retired.load(std::memory_order_acquire);
+                written += drain(*buffer);
+
+                if (retired)
+                {
+                    std::lock_guard<std::mutex> lock(s_Mutex);
+                    std::erase(s_Buffers, buffer);
+                }
+            }
+            buffers.clear();
+
+            if (written > 0)
+                std::fflush(s_File);
+
+            if (!running)
+                break;
+
+            std::unique_lock<std::mutex> lock(s_Mutex);
+            s_WakeCv.wait_for(lock, s_PollInterval, [] { return !s_Enabled.load(std::memory_order_acquire); });
+        }
+    }
+
+    template<typename Fn>
+    bool BinaryLogReader::Read(std::istream& in, Fn&& fn)
+    {
+        struct OwnedSite
+        {
+            std::string               format;
+            std::string               file;
+            uint32_t                  line = 0;
+            LogCategory               category = LogCategory::Core;
+            spdlog::level::level_enum level = spdlog::level::info;
+        };
+
+        auto readValue = [&](auto& value) { return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(value))); };
+        auto readString = [&](std::string& str)
+        {
+            uint32_t length = 0;
+            if (!readValue(length))
+                return false;
+            str.resize(length);
+            return static_cast<bool>(in.read(str.data(), length));
+        };
+
+        char magic[4];
+        uint32_t version = 0;
+        if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, internal::BinaryLogMagic, sizeof(magic)) != 0)
+            return false;
+        if (!readValue(version) || version != internal::BinaryLogVersion)
+            return false;
+
+        std::vector<OwnedSite> sites;
+        std::vector<std::byte> record;
+        fmt::memory_buffer     text;
+
+        for (;;)
+        {
+            const int block = in.get();
+            if (block == std::char_traits<char>::eof())
+                return true;
+
+            if (block == internal::BinaryLogSiteBlock)
+            {
+                uint32_t id = 0;
+                uint8_t category = 0;
+                uint8_t level = 0;
+                OwnedSite site;
+                if (!readValue(id) || !readValue(category) || !readValue(level) || !readValue(site.line)
+                    || !readString(site.format) || !readString(site.file))
+                    return false;
+                if (id != sites.size() + 1 || category >= LogCategoryCount || level >= spdlog::level::n_levels)
+                    return false;
+
+                site.category = static_cast<LogCategory>(category);
+                site.level = static_cast<spdlog::level::level_enum>(level);
+                sites.push_back(std::move(site));
+            }
+            else if (block == internal::BinaryLogRecordBlock)
+            {
+                internal::BinaryRecordHeader header;
+                if (!readValue(header) || header.size < sizeof(header) || header.siteId == 0 || header.siteId > sites.size())
+                    return false;
+
+                record.resize(header.size - sizeof(header));
+                if (!in.read(reinterpret_cast<char*>(record.data()), static_cast<std::streamsize>(record.size())))
+                    return false;
+
+                const OwnedSite& site = sites[header.siteId - 1];
+                text.clear();
+                internal::FormatBinaryArgs(site.format, record.data(), record.size(), text);
+
+                BinaryLogEntry entry;
+                entry.category = site.category;
+                entry.level = site.level;
+                entry.timestamp = header.timestamp;
+                entry.format = site.format;
+                entry.file = site.file;
+                entry.line = site.line;
+                entry.text = std::string_view(text.data(), text.size());
+                fn(entry);
+            }
+            else
+            {
+                return false;
+            }
+        }
+    }
+
+    inline bool BinaryLogReader::DecodeToText(std::istream& in, std::ostream& out)
+    {
+        fmt::memory_buffer line;
+        return Read(in, [&](const BinaryLogEntry& entry)
+        {
+            line.clear();
+            internal::FormatBinaryLogLine(entry, line);
+            out.write(line.data(), static_cast<std::streamsize>(line.size()));
+        });
+    }
+
+    inline bool BinaryLogReader::DecodeToText(const std::string& binaryPath, const std::string& textPath)
+    {
+        std::ifstream in(binaryPath, std::ios::binary);
+        std::ofstream out(textPath, std::ios::binary);
+        if (!in || !out)
+            return false;
+        return DecodeToText(in, out);
+    }
+#pragma endregion
+}
+
+// 분류 이름만 적는 매크로: CORE_BLOG_INFO(Graphics, "{} draws", count)
+// 포맷 문자열은 컴파일 시점에 인자와 함께 검사되고, 실행 시에는 처음 한 번만 등록된다
+#define CORE_BLOG_IMPL(category, level, ...) \
+    do { \
+        if (::core::BinaryLog::IsEnabled() && ::core::Log::ShouldLog(::core::LogCategory::category, (level))) \
+        { \
+            static std::atomic<uint32_t> coreBlogSite{ 0 }; \
+            ::core::BinaryLog::Write(coreBlogSite, ::core::LogCategory::category, (level), __FILE__, __LINE__, __VA_ARGS__); \
+        } \
+    } while (0)
+
+#if CORE_LOG_MIN_LEVEL <= SPDLOG_LEVEL_TRACE
+    #define CORE_BLOG_TRACE(category, ...) CORE_BLOG_IMPL(category, spdlog::level::trace, __VA_ARGS__)
+#else
+    #define CORE_BLOG_TRACE(category, ...) ((void)0)
+#endif
+#if CORE_LOG_MIN_LEVEL <= SPDLOG_LEVEL_DEBUG
+    #define CORE_BLOG_DEBUG(category, ...) CORE_BLOG_IMPL(category, spdlog::level::debug, __VA_ARGS__)
+#else
+    #define CORE_BLOG_DEBUG(category, ...) ((void)0)
+#endif
+#if CORE_LOG_MIN_LEVEL <= SPDLOG_LEVEL_INFO
+    #define CORE_BLOG_INFO(category, ...) CORE_BLOG_IMPL(category, spdlog::level::info, __VA_ARGS__)
+#else
+    #define CORE_BLOG_INFO(category, ...) ((void)0)
+#endif
+#if CORE_LOG_MIN_LEVEL <= SPDLOG_LEVEL_WARN
+    #define CORE_BLOG_WARN(category, ...) CORE_BLOG_IMPL(category, spdlog::level::warn, __VA_ARGS__)
+#else
+    #define CORE_BLOG_WARN(category, ...) ((void)0)
+#endif
+#if CORE_LOG_MIN_LEVEL <= SPDLOG_LEVEL_ERROR
+    #define CORE_BLOG_ERROR(category, ...) CORE_BLOG_IMPL(category, spdlog::level::err, __VA_ARGS__)
+#else
+    #define CORE_BLOG_ERROR(category, ...) ((void)0)
+#endif
+#if CORE_LOG_MIN_LEVEL <= SPDLOG_LEVEL_CRITICAL
+    #define CORE_BLOG_CRITICAL(category, ...) CORE_BLOG_IMPL(category, spdlog::level::critical, __VA_ARGS__)
+#else
+    #define CORE_BLOG_CRITICAL(category, ...) ((void)0)
+#endif
@@ -0,0 +1,137 @@
+﻿#pragma once
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+namespace core
+{
+    namespace internal
+    {
+        // 고정 용량 lock-free 큐 (Vyukov bounded queue)
+        // 셀마다 sequence 번호를 두어 여러 생산자가 CAS 한 번으로 자리를 잡는다
+        // 소비자는 보통 하나(로그 flush 스레드)지만, 넘침 정책(drop-oldest)을 위해 생산자도 TryPop 할 수 있다
+        //
+        // T 는 미리 생성되어 재사용된다. TryPush/TryPop 은 셀을 직접 채우고 읽는 함수를 받아
+        // std::string 같은 멤버가 용량을 재사용하도록 한다 (steady state 에서 힙 할당 없음)
+        template<typename T>
+        class BoundedQueue
+        {
+        public:
+            explicit BoundedQueue(size_t capacity);
+
+            BoundedQueue(const BoundedQueue&) = delete;
+            BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+            // 가득 차 있으면 false. fill(T&) 로 셀을 채운다
+            template<typename Fill>
+            bool TryPush(Fill&& fill);
+
+            // 비어 있으면 false. consume(T&) 로 셀을 읽는다
+            template<typename Consume>
+            bool TryPop(Consume&& consume);
+
+            // 근사치 (동시 변경 중에는 정확하지 않음)
+            size_t Size() const;
+            size_t Capacity() const { return _mask + 1; }
+
+        private:
+            struct Cell
+            {
+                std::atomic<size_t> sequence;
+                T                   value;
+            };
+
+            std::unique_ptr<Cell[]> _cells;
+            size_t                  _mask;
+
+            alignas(64) std::atomic<size_t> _enqueuePos{ 0 };
+            alignas(64) std::atomic<size_t> _dequeuePos{ 0 };
+        };
+
+#pragma region IMPLEMENTS
+        template<typename T>
+        BoundedQueue<T>::BoundedQueue(size_t capacity)
+        {
+            // 2의 거듭제곱으로 올림
+            size_t size = 2;
+            while (size < capacity) size <<= 1;
+
+            _cells = std::make_unique<Cell[]>(size);
+            _mask = size - 1;
+            for (size_t i = 0; i < size; ++i)
+                _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        template<typename T>
+        template<typename Fill>
+        bool BoundedQueue<T>::TryPush(Fill&& fill)
+        {
+            size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& cell = _cells[pos & _mask];
+                const size_t seq = cell.sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        fill(cell.value);
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;   // 가득 참
+                }
+                else
+                {
+                    pos = _enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        template<typename T>
+        template<typename Consume>
+        bool BoundedQueue<T>::TryPop(Consume&& consume)
+        {
+            size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& cell = _cells[pos & _mask];
+                const size_t seq = cell.sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        consume(cell.value);
+                        cell.sequence.store(pos + _mask + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;   // 비어 있음
+                }
+                else
+                {
+                    pos = _dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        template<typename T>
+        size_t BoundedQueue<T>::Size() const
+        {
+            const size_t head = _dequeuePos.load(std::memory_order_relaxed);
+            const size_t tail = _enqueuePos.load(std::memory_order_relaxed);
+            return tail > head ? tail - head : 0;
+        }
+#pragma endregion
+    }
+}
@@ -0,0 +1,284 @@
+﻿#include "pch.h"
+#include "CpuTopology.hpp"
+
+#include <string>
+#include <thread>
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <Windows.h>
+#elif defined(__linux__)
+    #include <sched.h>
+    #include <pthread.h>
+    #include <fstream>
+    #include <sstream>
+#endif
+
+namespace
+{
+#if defined(__linux__)
+    bool read_sysfs_u32(const std::string& path, uint32_t& out)
+    {
+        std::ifstream file(path);
+        uint64_t value = 0;
+        if (!(file >> value))
+            return false;
+        out = static_cast<uint32_t>(value);
+        return true;
+    }
+
+    // "0-3,8,10-11" 형식의 CPU 목록 파싱
+    std::vector<uint32_t> parse_cpu_list(const std::string& text)
+    {
+        std::vector<uint32_t> cpus;
+        std::stringstream ss(text);
+        std::string token;
+        while (std::getline(ss, token, ','))
+        {
+            if (token.empty()) continue;
+            const size_t dash = token.find('-');
+            const uint32_t first = static_cast<uint32_t>(std::stoul(token.substr(0, dash)));
+            const uint32_t last = dash == std::string::npos ? first : static_cast<uint32_t>(std::stoul(token.substr(dash + 1)));
+            for (uint32_t cpu = first; cpu <= last; ++cpu)
+                cpus.push_back(cpu);
+        }
+        return cpus;
+    }
+
+    struct LinuxCpuInfo
+    {
+        uint32_t cpu = 0;
+        uint32_t package = 0;
+        uint32_t core = 0;
+        uint32_t performance = 0;
+    };
+
+    // sysfs 가 없을 때 (일부 컨테이너) /proc/cpuinfo 로 대체
+    std::vector<LinuxCpuInfo> read_proc_cpuinfo()
+    {
+        std::vector<LinuxCpuInfo> cpus;
+        std::ifstream file("/proc/cpuinfo");
+        std::string line;
+        while (std::getline(file, line))
+        {
+            const size_t colon = line.find(':');
+            if (colon == std::string::npos) continue;
+
+            std::string key = line.substr(0, colon);
+            key.erase(key.find_last_not_of(" \t") + 1);
+            const std::string value = line.substr(colon + 1);
+
+            if (key == "processor")
+            {
+                cpus.push_back({});
+                cpus.back().cpu = static_cast<uint32_t>(std::stoul(value));
+                cpus.back().core = cpus.back().cpu;
+            }
+            else if (!cpus.empty() && key == "physical id")
+                cpus.back().package = static_cast<uint32_t>(std::stoul(value));
+            else if (!cpus.empty() && key == "core id")
+                cpus.back().core = static_cast<uint32_t>(std::stoul(value));
+        }
+        return cpus;
+    }
+
+    // 프로세스가 실제로 쓸 수 있는 CPU 만 남긴다 (taskset, cgroup cpuset, 컨테이너 제한)
+    // online 이어도 affinity 밖의 CPU 에 워커를 고정하면 pthread_setaffinity_np 가 실패한다
+    void filter_by_process_affinity(std::vector<LinuxCpuInfo>& cpus)
+    {
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0)
+            return;
+
+        std::vector<LinuxCpuInfo> usable;
+        for (const LinuxCpuInfo& info : cpus)
+        {
+            if (info.cpu < CPU_SETSIZE && CPU_ISSET(info.cpu, &allowed))
+                usable.push_back(info);
+        }
+
+        // 마스크가 CPU_SETSIZE 를 넘는 큰 시스템 등에서 전부 걸러지면 원래 목록을 유지
+        if (!usable.empty())
+            cpus.swap(usable);
+    }
+#endif
+}
+
+core::CpuTopology core::CpuTopology::Query()
+{
+    CpuTopology topology;
+
+#if defined(_WIN32)
+    DWORD length = 0;
+    GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+    std::vector<uint8_t> buffer(length);
+    auto* base = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data());
+
+    if (length > 0 && GetLogicalProcessorInformationEx(RelationAll, base, &length))
+    {
+        // 논리 프로세서 번호 = 그룹 * 64 + 비트 위치
+        std::vector<std::pair<KAFFINITY, WORD>> packages;
+        for (DWORD offset = 0; offset < length;)
+        {
+            auto* info = reinterpret_cast<SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer.data() + offset);
+            if (info->Relationship == RelationProcessorCore)
+            {
+                PhysicalCore core;
+                core.performance = info->Processor.EfficiencyClass;
+                for (WORD g = 0; g < info->Processor.GroupCount; ++g)
+                {
+                    const GROUP_AFFINITY& ga = info->Processor.GroupMask[g];
+                    for (uint32_t bit = 0; bit < sizeof(KAFFINITY) * 8; ++bit)
+                    {
+                        if (ga.Mask & (static_cast<KAFFINITY>(1) << bit))
+                            core.logicalProcessors.push_back(ga.Group * 64u + bit);
+                    }
+                }
+                topology._cores.push_back(std::move(core));
+            }
+            else if (info->Relationship == RelationProcessorPackage && info->Processor.GroupCount > 0)
+            {
+                packages.emplace_back(info->Processor.GroupMask[0].Mask, info->Processor.GroupMask[0].Group);
+            }
+            offset += info->Size;
+        }
+
+        for (PhysicalCore& core : topology._cores)
+        {
+            const uint32_t first = core.logicalProcessors.front();
+            for (uint32_t p = 0; p < packages.size(); ++p)
+            {
+                if (packages[p].second == first / 64 && (packages[p].first & (static_cast<KAFFINITY>(1) << (first % 64))))
+                    core.package = p;
+            }
+        }
+    }
+#elif defined(__linux__)
+    std::vector<LinuxCpuInfo> cpus;
+
+    std::ifstream onlineFile("/sys/devices/system/cpu/online");
+    std::string online;
+    if (std::getline(onlineFile, online))
+    {
+        for (uint32_t cpu : parse_cpu_list(online))
+        {
+            const std::string dir = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/";
+
+            LinuxCpuInfo info;
+            info.cpu = cpu;
+            info.core = cpu;
+            read_sysfs_u32(dir + "topology/physical_package_id", info.package);
+            read_sysfs_u32(dir + "topology/core_id", info.core);
+
+            // ARM big.LITTLE 는 cpu_capacity, x86 하이브리드는 최대 클럭으로 P/E 코어를 구분
+            if (!read_sysfs_u32(dir + "cpu_capacity", info.performance))
+                read_sysfs_u32(dir + "cpufreq/cpuinfo_max_freq", info.performance);
+
+            cpus.push_back(info);
+        }
+    }
+    if (cpus.empty())
+        cpus = read_proc_cpuinfo();
+
+    filter_by_process_affinity(cpus);
+
+    // (package, core_id) 가 같은 논리 프로세서를 하나의 물리 코어로 묶는다
+    std::vector<std::pair<uint32_t, uint32_t>> keys;  // _cores 와 같은 순서
+    for (const LinuxCpuInfo& info : cpus)
+    {
+        const auto key = std::make_pair(info.package, info.core);
+        const auto it = std::find(keys.begin(), keys.end(), key);
+
+        if (it == keys.end())
+        {
+            keys.push_back(key);
+            topology._cores.push_back(PhysicalCore{ { info.cpu }, info.package, info.performance });
+        }
+        else
+        {
+            PhysicalCore& core = topology._cores[static_cast<size_t>(it - keys.begin())];
+            core.logicalProcessors.push_back(info.cpu);
+            core.performance = (std::max)(core.performance, info.performance);
+        }
+    }
+#endif
+
+    // 조회 실패 시: 논리 프로세서 하나당 물리 코어 하나로 간주
+    if (topology._cores.empty())
+    {
+        const uint32_t count = (std::max)(1u, std::thread::hardware_concurrency());
+        for (uint32_t i = 0; i < count; ++i)
+            topology._cores.push_back(PhysicalCore{ { i }, 0, 0 });
+    }
+
+    topology.sortCores();
+    return topology;
+}
+
+const core::CpuTopology& core::CpuTopology::Get()
+{
+    static const CpuTopology s_Topology = Query();
+    return s_Topology;
+}
+
+void core::CpuTopology::sortCores()
+{
+    for (PhysicalCore& core : _cores)
+        std::sort(core.logicalProcessors.begin(), core.logicalProcessors.end());
+
+    std::stable_sort(_cores.begin(), _cores.end(), [](const PhysicalCore& a, const PhysicalCore& b)
+    {
+        if (a.performance != b.performance) return a.performance > b.performance;
+        if (a.package != b.package) return a.package < b.package;
+        return a.logicalProcessors.front() < b.logicalProcessors.front();
+    });
+}
+
+bool core::SetCurrentThreadAffinity(std::span<const uint32_t> logicalProcessors)
+{
+    if (logicalProcessors.empty())
+        return false;
+
+#if defined(_WIN32)
+    // 스레드는 한 프로세서 그룹에만 묶을 수 있으므로 첫 번째 프로세서의 그룹을 사용
+    GROUP_AFFINITY affinity = {};
+    affinity.Group = static_cast<WORD>(logicalProcessors.front() / 64);
+    for (uint32_t cpu : logicalProcessors)
+    {
+        if (cpu / 64 == affinity.Group)
+            affinity.Mask |= static_cast<KAFFINITY>(1) << (cpu % 64);
+    }
+    return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != 0;
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (uint32_t cpu : logicalProcessors)
+    {
+        if (cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+void core::SetCurrentThreadName(std::string_view name)
+{
+#if defined(_WIN32)
+    const std::wstring wide(name.begin(), name.end());
+    SetThreadDescription(GetCurrentThread(), wide.c_str());
+#elif defined(__linux__)
+    // 커널 제한: NUL 포함 16 바이트
+    const std::string truncated(name.substr(0, 15));
+    pthread_setname_np(pthread_self(), truncated.c_str());
+#else
+    (void)name;
+#endif
+}
@@ -0,0 +1,70 @@
+﻿#pragma once
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <string_view>
+
+// 플랫폼 API(Windows.h, sched.h 등)를 쓰는 부분은 CpuTopology.cpp 에 있다
+// ThreadPool 을 include 하는 모든 파일에 Windows.h 가 딸려 들어가지 않도록 이 헤더는 표준 헤더만 쓴다
+
+namespace core
+{
+    // 물리 코어 하나와 그에 속한 논리 프로세서(SMT 형제)들
+    struct PhysicalCore
+    {
+        std::vector<uint32_t> logicalProcessors;  // 첫 번째가 대표(primary) 논리 프로세서
+        uint32_t package = 0;
+        uint32_t performance = 0;                 // 클수록 빠른 코어 (하이브리드 CPU 의 P/E 구분용, 상대값)
+    };
+
+    // CPU 토폴로지
+    // - Windows: GetLogicalProcessorInformationEx
+    // - Linux  : /sys/devices/system/cpu/cpuN/topology, cpu_capacity, cpufreq (없으면 /proc/cpuinfo)
+    //            프로세스 affinity(sched_getaffinity) 밖의 CPU 는 제외 (taskset, cgroup cpuset 등)
+    // 물리 코어는 성능 내림차순, 같은 성능이면 패키지/번호 순으로 정렬된다
+    class CpuTopology
+	{
+    public:
+        static CpuTopology Query();
+
+        // 한 번 조회한 결과를 캐시
+        static const CpuTopology& Get();
+
+        const std::vector<PhysicalCore>& GetPhysicalCores() const { return _cores; }
+        size_t GetPhysicalCoreCount() const { return _cores.size(); }
+        size_t GetLogicalProcessorCount() const;
+
+        // 성능 등급이 둘 이상이면 하이브리드 (P-core / E-core, big.LITTLE)
+        bool IsHybrid() const;
+
+    private:
+        void sortCores();
+
+        std::vector<PhysicalCore> _cores;
+    };
+
+    // 현재 스레드를 주어진 논리 프로세서 집합으로 제한. 실패하거나 지원하지 않으면 false
+    bool SetCurrentThreadAffinity(std::span<const uint32_t> logicalProcessors);
+
+    // 프로파일러 / 디버거 / perf 에 보이는 스레드 이름 설정 (Linux 는 최대 15 자)
+    void SetCurrentThreadName(std::string_view name);
+
+#pragma region IMPLEMENTS
+    inline size_t CpuTopology::GetLogicalProcessorCount() const
+    {
+        size_t count = 0;
+        for (const PhysicalCore& core : _cores)
+            count += core.logicalProcessors.size();
+        return count;
+    }
+
+    inline bool CpuTopology::IsHybrid() const
+    {
+        return std::any_of(_cores.begin(), _cores.end(), [this](const PhysicalCore& core)
+        {
+            return core.performance != _cores.front().performance;
+        });
+    }
+#pragma endregion
+}
\ No newline at end of file
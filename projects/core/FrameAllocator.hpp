@@ -1,21 +1,44 @@
 ﻿#pragma once
 #include <new>
-#include <vector>
+#include <memory_resource>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+
+#include "VirtualMemory.hpp"
+#include "MemoryTracker.hpp"
+#include "Sanitizer.hpp"
+
+// 디버그 채움 패턴/가드 바이트 (릴리스에서는 코드가 남지 않는다)
+#ifndef CORE_FRAME_ALLOCATOR_DEBUG
+#if defined(_DEBUG) || !defined(NDEBUG)
+#define CORE_FRAME_ALLOCATOR_DEBUG 1
+#else
+#define CORE_FRAME_ALLOCATOR_DEBUG 0
+#endif
+#endif
+
+// 0 보다 크면 디버그 빌드에서 할당마다 뒤에 가드 바이트를 두고 되감을 때 덮어쓰기를 검사한다
+#ifndef CORE_FRAME_ALLOCATOR_GUARD_BYTES
+#define CORE_FRAME_ALLOCATOR_GUARD_BYTES 0
+#endif
 
 namespace core
 {
-	namespace internal
-	{
-        // 소멸자 콜백 경량 구조체
+    namespace internal
+    {
+        // 소멸자 콜백 경량 구조체 (아레나 안에 할당되어 침습 리스트로 연결)
         using DestructorFunc = void(*)(void*);
 
         struct DestructorEntry
-		{
+        {
             DestructorFunc fn;  // 호출할 소멸자 함수 포인터
             void* obj;  // 소멸시킬 객체 인스턴스의 주소
+            DestructorEntry* next;  // 직전에 등록된 항목
         };
 
         // n      : 현재 주소나 크기
@@ -24,15 +47,70 @@ namespace core
         {
             return (n + (align - 1)) & ~(align - 1);
         }
-	}
 
-    class FrameAllocator
-	{
+        // Chained 모드에서 기본 블록이 넘칠 때 붙이는 추가 청크의 헤더 (데이터가 바로 뒤에 옴)
+        struct alignas(std::max_align_t) FrameChunk
+        {
+            FrameChunk* next;
+            size_t      size;   // 헤더를 제외한 데이터 크기
+            uint8_t*    prevTop; // 이 청크로 넘어올 때 이전 블록의 bump 위치
+        };
+
+        // 디버그 채움 패턴
+        constexpr uint8_t FrameFillAllocated = 0xCD;   // 할당 직후 (초기화 안 된 읽기 탐지)
+        constexpr uint8_t FrameFillFreed = 0xDD;       // Reset/RollbackTo 이후 (되감긴 메모리 사용 탐지)
+        constexpr uint8_t FrameFillGuard = 0xFD;       // 가드 바이트
+
+        // 가드 바이트 위치 기록 (아레나 안에 할당, 침습 리스트)
+        struct GuardRecord
+        {
+            GuardRecord* prev;
+            uint8_t*     bytes;
+        };
+    }
+
+    // 용량을 넘었을 때의 동작
+    enum class FrameAllocatorGrowth : uint8_t
+    {
+        Fixed,      // std::bad_alloc
+        Chained,    // 추가 청크를 붙이고, 다음 Reset 에서 high-water mark 크기의 단일 블록으로 합친다
+        Reserved,   // size 만큼 가상 주소만 예약하고 필요한 만큼 커밋, 주기적으로 최근 최대 사용량까지 디커밋
+    };
+
+    struct FrameAllocatorDesc
+    {
+        size_t               size = 0;              // Reserved 면 예약할 가상 주소 크기, 아니면 블록 크기
+        FrameAllocatorGrowth growth = FrameAllocatorGrowth::Fixed;
+        MemoryTag            tag = MemoryTag::FrameArena;   // MemoryTracker 에 용량/프레임 사용량을 보고할 태그
+
+        // Reserved 전용
+        HugePageMode         hugePages = HugePageMode::None;
+        size_t               minCommit = 0;         // 트림해도 남겨 둘 커밋 크기
+        uint32_t             trimInterval = 120;    // 이 횟수의 Reset 동안 관측한 최대 사용량 위쪽을 디커밋
+    };
+
+    // std::pmr 컨테이너의 memory_resource 로도 쓸 수 있다 (core::frame::vector 등, FrameContainers.hpp)
+    class FrameAllocator : public std::pmr::memory_resource
+    {
     public:
-        explicit FrameAllocator(size_t totalSize);
+        // 되감기 지점. GetMarker 이후 할당/생성된 것만 RollbackTo 로 해제된다
+        struct Marker
+        {
+            internal::FrameChunk* chunk = nullptr;  // 마커 시점의 최신 추가 청크 (nullptr = 기본 블록)
+            uint8_t*              ptr = nullptr;
+            size_t                chainedUsed = 0;
+            internal::DestructorEntry* destructors = nullptr;  // 마커 시점의 소멸자 리스트 머리
+            internal::GuardRecord*     guards = nullptr;
+        };
+
+        explicit FrameAllocator(size_t totalSize, FrameAllocatorGrowth growth = FrameAllocatorGrowth::Fixed);
+        explicit FrameAllocator(const FrameAllocatorDesc& desc);
 
         ~FrameAllocator();
 
+        FrameAllocator(const FrameAllocator&) = delete;
+        FrameAllocator& operator=(const FrameAllocator&) = delete;
+
         // 1) raw 메모리 Allocate
         void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
 
@@ -42,64 +120,476 @@ namespace core
 
         void Reset();
 
+        Marker GetMarker() const;
+
+        // 마커 이후 등록된 소멸자를 역순으로 실행하고 그 이후의 메모리를 되돌린다
+        void RollbackTo(const Marker& marker);
+
+        // 이번 프레임 사용량 (추가 청크 포함)
+        size_t GetUsedSize() const { return _chainedUsed + static_cast<size_t>(_ptr - _chunkBegin); }
+        // 기본 블록(Reserved 면 커밋된 구간) + 추가 청크 용량
+        size_t GetCapacity() const { return static_cast<size_t>(_blockEnd - _start) + _chainedCapacity; }
+        // 지금까지 한 프레임에서 사용한 최대량
+        size_t GetHighWaterMark() const { return _highWater > GetUsedSize() ? _highWater : GetUsedSize(); }
+        // 이번 프레임(마지막 Reset 이후)의 최대 사용량. ScopedArena 등으로 중간에 되감은 양도 포함
+        size_t GetFramePeak() const { return _framePeak > GetUsedSize() ? _framePeak : GetUsedSize(); }
+        // 기본 블록을 포함한 블록 수 (steady state 에서는 1)
+        size_t GetChunkCount() const;
+        // 마지막 Reset 이후 할당의 가드 바이트가 모두 온전한지 (가드를 쓰지 않는 빌드에서는 항상 true)
+        bool ValidateGuards() const { return guardsIntact(nullptr); }
+
+    protected:
+        // std::pmr::memory_resource: 해제는 no-op (Reset/RollbackTo 에서 한 번에 반환)
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override { return Allocate(bytes, alignment); }
+        void  do_deallocate(void*, std::size_t, std::size_t) override {}
+        bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
     private:
-        uint8_t* _start = nullptr;
+        void* bump(std::size_t size, std::size_t alignment);
+        void* allocateChunk(std::size_t size, std::size_t alignment);
+        void  releaseRange(uint8_t* begin, uint8_t* end);
+        void  unpoisonBlock(uint8_t* begin, size_t size);
+        void  checkGuards(internal::GuardRecord* until);
+        bool  guardsIntact(const internal::GuardRecord* until) const;
+        void* commitMore(std::size_t size, std::size_t alignment);
+        void  trimCommitted(size_t framePeak);
+        void  trackCapacity();
+        void  releaseChunks();
+
+        uint8_t* _start = nullptr;      // 기본 블록
+        uint8_t* _blockEnd = nullptr;
+        uint8_t* _chunkBegin = nullptr; // 현재 bump 중인 블록의 시작
         uint8_t* _ptr = nullptr;
         uint8_t* _end = nullptr;
 
-        std::vector<internal::DestructorEntry> _destructors;
+        internal::FrameChunk* _chunks = nullptr;    // 추가 청크 (최근 것이 앞)
+        size_t                _chainedUsed = 0;     // 현재 블록 이전 블록들에서 사용한 양
+        size_t                _chainedCapacity = 0;
+        size_t                _highWater = 0;
+        size_t                _framePeak = 0;       // 이번 프레임에서 RollbackTo 직전에 관측한 최대 사용량
+        FrameAllocatorGrowth  _growth;
+        MemoryTag             _tag;
+        size_t                _trackedBytes = 0;    // MemoryTracker 에 보고한 용량
+
+        // Reserved 모드
+        internal::VirtualRange _range;
+        size_t                 _commitGranularity = 0;
+        size_t                 _minCommit = 0;
+        size_t                 _windowPeak = 0;     // 이번 트림 구간의 프레임 최대 사용량 중 최대값
+        uint32_t               _trimInterval = 0;
+        uint32_t               _resetCount = 0;
+
+        // 가장 최근에 등록된 항목이 머리인 LIFO 리스트 -> 순회하면 생성의 역순
+        // 항목 자체도 아레나에 있으므로 생성 이후 힙 할당이 없다
+        internal::DestructorEntry* _destructors = nullptr;
+        internal::GuardRecord*     _guards = nullptr;
+    };
+
+    // 스코프를 벗어날 때 생성 시점의 마커로 되감는 임시 아레나 (정렬 버퍼, 중간 정점 배열 등)
+    class ScopedArena : public std::pmr::memory_resource
+    {
+    public:
+        explicit ScopedArena(FrameAllocator& allocator)
+            : _allocator(allocator), _marker(allocator.GetMarker()) {}
+
+        ~ScopedArena() { _allocator.RollbackTo(_marker); }
+
+        ScopedArena(const ScopedArena&) = delete;
+        ScopedArena& operator=(const ScopedArena&) = delete;
+
+        void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+        {
+            return _allocator.Allocate(size, alignment);
+        }
+
+        template<typename T, typename... Args>
+        T* Create(Args&&... args)
+        {
+            return _allocator.Create<T>(std::forward<Args>(args)...);
+        }
+
+        FrameAllocator& GetAllocator() const { return _allocator; }
+
+    protected:
+        // std::pmr::memory_resource: 해제는 no-op (Reset/RollbackTo 에서 한 번에 반환)
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override { return _allocator.Allocate(bytes, alignment); }
+        void  do_deallocate(void*, std::size_t, std::size_t) override {}
+        bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    private:
+        FrameAllocator&              _allocator;
+        FrameAllocator::Marker       _marker;
     };
 
-    inline FrameAllocator::FrameAllocator(size_t totalSize)
+    inline FrameAllocator::FrameAllocator(size_t totalSize, FrameAllocatorGrowth growth)
+        : FrameAllocator(FrameAllocatorDesc{ totalSize, growth })
     {
-	    // OS 할당 (new[] 로 대체 가능)
-	    _start = static_cast<uint8_t*>(std::malloc(totalSize));
-	    assert(_start && "FrameAllocator: 메모리 할당 실패");
-	    _ptr = _start;
-	    _end = _start + totalSize;
+    }
+
+    inline FrameAllocator::FrameAllocator(const FrameAllocatorDesc& desc)
+        : _growth(desc.growth), _tag(desc.tag)
+    {
+        if (_growth == FrameAllocatorGrowth::Reserved)
+        {
+            // 가상 주소만 예약. THP/large page 가 붙을 수 있도록 huge page 모드에서는 2MB 단위로 커밋
+            _range = internal::vm_reserve(desc.size, desc.hugePages);
+            if (!_range.base) throw std::bad_alloc();
+
+            const size_t unit = desc.hugePages != HugePageMode::None ? (size_t{ 2 } << 20) : (size_t{ 64 } << 10);
+            _commitGranularity = _range.pageSize > unit ? _range.pageSize : unit;
+            _trimInterval = desc.trimInterval > 0 ? desc.trimInterval : 1;
+
+            const size_t initial = internal::align_up(desc.minCommit, _commitGranularity);
+            _minCommit = initial < _range.size ? initial : _range.size;
+            if (_minCommit > 0 && !internal::vm_commit(_range, _range.base, _minCommit))
+            {
+                internal::vm_release(_range);
+                throw std::bad_alloc();
+            }
+
+            // 미리 커밋된 huge page 구간은 전체를 쓰고, 트림 시 물리 페이지만 돌려준다
+            _start = _range.base;
+            _blockEnd = _start + (_range.committedUpFront ? _range.size : _minCommit);
+            _chunkBegin = _start;
+            _ptr = _start;
+            _end = _blockEnd;
+            trackCapacity();
+            return;
+        }
+
+        // OS 할당 (new[] 로 대체 가능)
+        _start = static_cast<uint8_t*>(std::malloc(desc.size));
+        assert(_start && "FrameAllocator: 메모리 할당 실패");
+        _blockEnd = _start + desc.size;
+        _chunkBegin = _start;
+        _ptr = _start;
+        _end = _blockEnd;
+        trackCapacity();
     }
 
     inline FrameAllocator::~FrameAllocator()
     {
-	    std::free(_start);
+        // 아직 Reset 되지 않은 객체도 소멸시킨다
+        for (internal::DestructorEntry* e = _destructors; e; e = e->next)
+            e->fn(e->obj);
+
+        releaseChunks();
+        MemoryTracker::RecordFree(_tag, _trackedBytes);
+        if (_growth == FrameAllocatorGrowth::Reserved)
+        {
+            // 예약 구간 전체가 아니라 실제로 사용(=poison)된 적이 있는 구간만
+            unpoisonBlock(_start, GetHighWaterMark());
+            internal::vm_release(_range);
+        }
+        else
+        {
+            unpoisonBlock(_start, static_cast<size_t>(_blockEnd - _start));
+            std::free(_start);
+        }
     }
 
     inline void* FrameAllocator::Allocate(std::size_t size, std::size_t alignment)
     {
-	    const std::uintptr_t curr = reinterpret_cast<std::uintptr_t>(_ptr);
-	    const std::uintptr_t aligned = internal::align_up(curr, alignment);
-	    std::uint8_t* nextPtr = reinterpret_cast<std::uint8_t*>(aligned) + size;
+#if CORE_FRAME_ALLOCATOR_DEBUG && CORE_FRAME_ALLOCATOR_GUARD_BYTES > 0
+        constexpr size_t guardSize = CORE_FRAME_ALLOCATOR_GUARD_BYTES;
+        uint8_t* result = static_cast<uint8_t*>(bump(size + guardSize, alignment));
+
+        auto* record = static_cast<internal::GuardRecord*>(bump(sizeof(internal::GuardRecord), alignof(internal::GuardRecord)));
+        CORE_ASAN_UNPOISON(record, sizeof(internal::GuardRecord));
+        record->prev = _guards;
+        record->bytes = result + size;
+        _guards = record;
+
+        CORE_ASAN_UNPOISON(record->bytes, guardSize);
+        std::memset(record->bytes, internal::FrameFillGuard, guardSize);
+        CORE_ASAN_POISON(record->bytes, guardSize);
+#else
+        void* result = bump(size, alignment);
+#endif
+        // 이전 RollbackTo 에서 poison 된 구간일 수 있다
+        CORE_ASAN_UNPOISON(result, size);
+#if CORE_FRAME_ALLOCATOR_DEBUG
+        std::memset(result, internal::FrameFillAllocated, size);
+#endif
+        return result;
+    }
+
+    inline void* FrameAllocator::bump(std::size_t size, std::size_t alignment)
+    {
+        const std::uintptr_t curr = reinterpret_cast<std::uintptr_t>(_ptr);
+        const std::uintptr_t aligned = internal::align_up(curr, alignment);
+        std::uint8_t* nextPtr = reinterpret_cast<std::uint8_t*>(aligned) + size;
 
-	    if (nextPtr > _end) throw std::bad_alloc();
-	    void* result = reinterpret_cast<void*>(aligned);
-	    _ptr = nextPtr;
-	    return result;
+        if (nextPtr > _end) return allocateChunk(size, alignment);
+        void* result = reinterpret_cast<void*>(aligned);
+        _ptr = nextPtr;
+        return result;
     }
 
     template <typename T, typename ... Args>
     T* FrameAllocator::Create(Args&&... args)
     {
-	    // 메모리 확보 + 생성자 호출
-	    void* raw = Allocate(sizeof(T), alignof(T));
-	    T* obj = new (raw) T(std::forward<Args>(args)...);
+        // non-trivial 타입만 소멸자 등록
+        // 생성 후 항목 할당이 실패해 소멸자가 누락되지 않도록 항목 자리를 먼저 확보한다
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+            void* entryRaw = Allocate(sizeof(internal::DestructorEntry), alignof(internal::DestructorEntry));
+
+            // 메모리 확보 + 생성자 호출
+            void* raw = Allocate(sizeof(T), alignof(T));
+            T* obj = new (raw) T(std::forward<Args>(args)...);
 
-	    // non-trivial 타입만 소멸자 등록
-	    if constexpr (!std::is_trivially_destructible_v<T>)
-	    {
-		    _destructors.push_back({
-			    [](void* p) { static_cast<T*>(p)->~T(); },
-			    obj
-		    });
-	    }
-	    return obj;
+            _destructors = new (entryRaw) internal::DestructorEntry{
+                [](void* p) { static_cast<T*>(p)->~T(); },
+                obj,
+                _destructors
+            };
+            return obj;
+        }
+        else
+        {
+            // 메모리 확보 + 생성자 호출
+            void* raw = Allocate(sizeof(T), alignof(T));
+            return new (raw) T(std::forward<Args>(args)...);
+        }
     }
 
     inline void FrameAllocator::Reset()
     {
-	    for (const auto& e : _destructors) 
-		    e.fn(e.obj);
+        RollbackTo(Marker{});
+    }
 
-	    _destructors.clear();
-	    _ptr = _start;
+    inline FrameAllocator::Marker FrameAllocator::GetMarker() const
+    {
+        return Marker{ _chunks, _ptr, _chainedUsed, _destructors, _guards };
+    }
+
+    inline void FrameAllocator::RollbackTo(const Marker& marker)
+    {
+        // 생성의 역순으로 소멸 (항목 메모리는 아래에서 포인터를 되감을 때 함께 반환)
+        while (_destructors != marker.destructors)
+        {
+            assert(_destructors && "FrameAllocator: 이미 되감긴 마커");
+            internal::DestructorEntry* e = _destructors;
+            _destructors = e->next;
+            e->fn(e->obj);
+        }
+
+        checkGuards(marker.guards);
+        _guards = marker.guards;
+
+        // 사용량은 할당할 때 늘기만 하고 줄어드는 곳은 여기뿐이므로, 되감기 직전 값만 보면 프레임 최대치가 된다
+        // (Allocate 마다 비교하지 않아 bump 경로가 그대로 유지된다)
+        _framePeak = GetFramePeak();
+        _highWater = GetHighWaterMark();
+
+        // 마커 이후 붙은 청크 해제
+        uint8_t* top = _ptr;    // 되돌아갈 블록에서 사용했던 끝
+        while (_chunks != marker.chunk)
+        {
+            assert(_chunks && "FrameAllocator: 마커의 청크가 이미 해제됨");
+            internal::FrameChunk* next = _chunks->next;
+            top = _chunks->prevTop;
+            _chainedCapacity -= _chunks->size;
+            unpoisonBlock(reinterpret_cast<uint8_t*>(_chunks + 1), _chunks->size);
+            std::free(_chunks);
+            _chunks = next;
+        }
+
+        if (marker.chunk)
+        {
+            _chunkBegin = reinterpret_cast<uint8_t*>(marker.chunk + 1);
+            _end = _chunkBegin + marker.chunk->size;
+        }
+        else
+        {
+            _chunkBegin = _start;
+            _end = _blockEnd;
+        }
+        _ptr = marker.ptr ? marker.ptr : _chunkBegin;
+        _chainedUsed = marker.chainedUsed;
+        releaseRange(_ptr, top);
+
+        if (marker.ptr)
+        {
+            trackCapacity();
+            return;
+        }
+
+        const size_t framePeak = _framePeak;
+        _framePeak = 0;
+
+        // 프레임 끝 사용량이 아니라 최대치를 보고해야 ScopedArena 로 되감은 스크래치까지 예산에 잡힌다
+        MemoryTracker::RecordArenaUsage(_tag, framePeak);
+        if (_growth == FrameAllocatorGrowth::Reserved)
+        {
+            trimCommitted(framePeak);
+        }
+        // 프레임 전체 되감기 시 넘쳤던 적이 있으면 high-water mark 에 여유분(1/8)을 더한 단일 블록으로 다시 잡는다
+        else if (_highWater > static_cast<size_t>(_blockEnd - _start))
+        {
+            const size_t size = internal::align_up(_highWater + _highWater / 8, alignof(std::max_align_t));
+            uint8_t* block = static_cast<uint8_t*>(std::malloc(size));
+            if (block)
+            {
+                unpoisonBlock(_start, static_cast<size_t>(_blockEnd - _start));
+                std::free(_start);
+                _start = block;
+                _blockEnd = block + size;
+                _chunkBegin = _start;
+                _ptr = _start;
+                _end = _blockEnd;
+            }
+        }
+        trackCapacity();
+    }
+
+    inline size_t FrameAllocator::GetChunkCount() const
+    {
+        size_t count = 1;
+        for (const internal::FrameChunk* chunk = _chunks; chunk; chunk = chunk->next)
+            ++count;
+        return count;
+    }
+
+    inline void* FrameAllocator::allocateChunk(std::size_t size, std::size_t alignment)
+    {
+        if (_growth == FrameAllocatorGrowth::Fixed) throw std::bad_alloc();
+        if (_growth == FrameAllocatorGrowth::Reserved) return commitMore(size, alignment);
+
+        // 지금까지의 총 용량만큼 (최소 요청 크기 + 정렬 여유) 늘려서 청크 수를 로그 단위로 유지
+        const size_t capacity = GetCapacity();
+        const size_t dataSize = capacity > size + alignment ? capacity : size + alignment;
+
+        auto* chunk = static_cast<internal::FrameChunk*>(std::malloc(sizeof(internal::FrameChunk) + dataSize));
+        if (!chunk) throw std::bad_alloc();
+
+        chunk->next = _chunks;
+        chunk->size = dataSize;
+        chunk->prevTop = _ptr;
+        _chunks = chunk;
+
+        _chainedUsed += static_cast<size_t>(_ptr - _chunkBegin);
+        _chainedCapacity += dataSize;
+        trackCapacity();
+        _chunkBegin = reinterpret_cast<uint8_t*>(chunk + 1);
+        _ptr = _chunkBegin;
+        _end = _chunkBegin + dataSize;
+
+        const std::uintptr_t aligned = internal::align_up(reinterpret_cast<std::uintptr_t>(_ptr), alignment);
+        _ptr = reinterpret_cast<std::uint8_t*>(aligned) + size;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    inline void* FrameAllocator::commitMore(std::size_t size, std::size_t alignment)
+    {
+        const std::uintptr_t aligned = internal::align_up(reinterpret_cast<std::uintptr_t>(_ptr), alignment);
+        const size_t needed = aligned + size - reinterpret_cast<std::uintptr_t>(_start);
+        if (needed > _range.size) throw std::bad_alloc();
+
+        // 예약 구간 안에서 커밋 단위로 늘린다
+        size_t committed = internal::align_up(needed, _commitGranularity);
+        if (committed > _range.size) committed = _range.size;
+
+        uint8_t* commitBegin = _blockEnd;
+        if (!internal::vm_commit(_range, commitBegin, committed - static_cast<size_t>(commitBegin - _start)))
+            throw std::bad_alloc();
+
+        _blockEnd = _start + committed;
+        _end = _blockEnd;
+        trackCapacity();
+        _ptr = reinterpret_cast<std::uint8_t*>(aligned) + size;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    inline void FrameAllocator::trimCommitted(size_t framePeak)
+    {
+        // 한 번의 스파이크가 커밋을 영구히 잡아 두지 않도록 trimInterval 번의 Reset 마다 최근 최대 사용량까지 줄인다
+        // 프레임 끝의 사용량이 아니라 프레임 중 최대치를 기준으로 해야, 프레임 중간에 되감는 사용 패턴에서 매 프레임 다시 커밋하지 않는다
+        if (framePeak > _windowPeak) _windowPeak = framePeak;
+        if (++_resetCount < _trimInterval)
+            return;
+
+        size_t keep = internal::align_up(_windowPeak, _commitGranularity);
+        if (keep < _minCommit) keep = _minCommit;
+
+        const size_t committed = static_cast<size_t>(_blockEnd - _start);
+        if (committed > keep)
+        {
+            internal::vm_decommit(_range, _start + keep, committed - keep);
+            if (!_range.committedUpFront)
+            {
+                _blockEnd = _start + keep;
+                _end = _blockEnd;
+            }
+        }
+
+        _windowPeak = 0;
+        _resetCount = 0;
+    }
+
+    inline void FrameAllocator::trackCapacity()
+    {
+        const size_t capacity = GetCapacity();
+        if (capacity > _trackedBytes)
+            MemoryTracker::RecordAlloc(_tag, capacity - _trackedBytes);
+        else if (capacity < _trackedBytes)
+            MemoryTracker::RecordFree(_tag, _trackedBytes - capacity);
+        _trackedBytes = capacity;
+    }
+
+    inline void FrameAllocator::releaseRange(uint8_t* begin, uint8_t* end)
+    {
+        if (begin >= end)
+            return;
+
+        // 되감긴 메모리: 디버그에서는 패턴으로 덮고, ASan 빌드에서는 접근 자체를 잡는다
+#if CORE_FRAME_ALLOCATOR_DEBUG
+        CORE_ASAN_UNPOISON(begin, static_cast<size_t>(end - begin));
+        std::memset(begin, internal::FrameFillFreed, static_cast<size_t>(end - begin));
+#endif
+        CORE_ASAN_POISON(begin, static_cast<size_t>(end - begin));
+    }
+
+    inline void FrameAllocator::unpoisonBlock(uint8_t* begin, size_t size)
+    {
+        // poison 된 채로 free/munmap 하면 같은 주소를 재사용하는 다른 할당이 오탐된다
+        CORE_ASAN_UNPOISON(begin, size);
+    }
+
+    inline void FrameAllocator::checkGuards(internal::GuardRecord* until)
+    {
+        assert(guardsIntact(until) && "FrameAllocator: 할당 범위를 넘어 쓴 흔적 (가드 바이트 손상)");
+        (void)until;
+    }
+
+    inline bool FrameAllocator::guardsIntact(const internal::GuardRecord* until) const
+    {
+#if CORE_FRAME_ALLOCATOR_DEBUG && CORE_FRAME_ALLOCATOR_GUARD_BYTES > 0 && !CORE_ASAN_ENABLED
+        // ASan 빌드에서는 가드가 poison 되어 있어 덮어쓰는 순간 잡히므로 검사하지 않는다
+        for (const internal::GuardRecord* g = _guards; g != until; g = g->prev)
+        {
+            for (size_t i = 0; i < CORE_FRAME_ALLOCATOR_GUARD_BYTES; ++i)
+            {
+                if (g->bytes[i] != internal::FrameFillGuard)
+                    return false;
+            }
+        }
+#else
+        (void)until;
+#endif
+        return true;
+    }
+
+    inline void FrameAllocator::releaseChunks()
+    {
+        while (_chunks)
+        {
+            internal::FrameChunk* next = _chunks->next;
+            unpoisonBlock(reinterpret_cast<uint8_t*>(_chunks + 1), _chunks->size);
+            std::free(_chunks);
+            _chunks = next;
+        }
+        _chainedCapacity = 0;
     }
 }
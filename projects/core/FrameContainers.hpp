@@ -0,0 +1,30 @@
+﻿#pragma once
+#include <string>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+#include <memory_resource>
+
+#include "FrameAllocator.hpp"
+
+// 프레임 수명 컨테이너
+// FrameAllocator / ScopedArena / WorkerFrameAllocator / MultiFrameAllocator 를 memory_resource 로 넘기면
+// 원소 메모리가 아레나에서 bump 할당되고 해제는 no-op 이 된다
+//
+//  core::frame::vector<DrawItem> drawList(&frameAllocator);
+//  drawList.reserve(count);
+//
+// 컨테이너 객체 자체는 아레나가 Reset 되기 전에 소멸되어야 한다 (또는 Create<frame::vector<T>>(&allocator) 로 만들 것)
+namespace core
+{
+    namespace frame
+    {
+        template<typename T>
+        using vector = std::pmr::vector<T>;
+
+        using string = std::pmr::string;
+
+        template<typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+        using unordered_map = std::pmr::unordered_map<Key, Value, Hash, KeyEqual>;
+    }
+}
@@ -0,0 +1,268 @@
+﻿#pragma once
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cassert>
+#include <utility>
+#include <optional>
+#include <exception>
+#include <type_traits>
+
+#include "ThreadPool.hpp"
+
+namespace core
+{
+    namespace internal
+    {
+        // Future 공유 상태 (값 타입과 무관한 부분)
+        class FutureStateBase
+        {
+        public:
+            explicit FutureStateBase(ThreadPool* pool) : _pool(pool) {}
+            virtual ~FutureStateBase() = default;
+
+            bool IsReady() const { return _ready.load(std::memory_order_acquire); }
+            ThreadPool* GetPool() const { return _pool; }
+            const std::exception_ptr& GetError() const { return _error; }
+
+            // 완료되면 풀에 등록할 후속 작업. 이미 완료됐다면 바로 등록한다
+            void AddContinuation(Job job, JobPriority priority);
+
+            void Wait() const;
+
+        protected:
+            // 결과(값 또는 예외)를 기록한 뒤 호출: 대기자를 깨우고 후속 작업을 스케줄
+            void markReady();
+
+            ThreadPool*            _pool;
+            std::exception_ptr     _error;
+
+        private:
+            struct Continuation
+            {
+                Job          job;
+                JobPriority  priority;
+            };
+
+            std::mutex                  _mutex;
+            std::vector<Continuation>   _continuations;
+            std::atomic<bool>           _ready { false };
+        };
+
+        template<typename T>
+        class FutureState : public FutureStateBase
+        {
+        public:
+            using FutureStateBase::FutureStateBase;
+
+            void SetValue(T value) { _value.emplace(std::move(value)); markReady(); }
+            void SetError(std::exception_ptr error) { _error = std::move(error); markReady(); }
+
+            T& GetValue() { return *_value; }
+
+        private:
+            std::optional<T> _value;
+        };
+
+        template<>
+        class FutureState<void> : public FutureStateBase
+        {
+        public:
+            using FutureStateBase::FutureStateBase;
+
+            void SetValue() { markReady(); }
+            void SetError(std::exception_ptr error) { _error = std::move(error); markReady(); }
+        };
+
+        // fn 을 실행해 state 에 결과 또는 예외를 기록
+        template<typename T, typename Fn, typename... Args>
+        void fulfill(FutureState<T>& state, Fn& fn, Args&&... args)
+        {
+            try
+            {
+                if constexpr (std::is_void_v<T>)
+                {
+                    fn(std::forward<Args>(args)...);
+                    state.SetValue();
+                }
+                else
+                {
+                    state.SetValue(fn(std::forward<Args>(args)...));
+                }
+            }
+            catch (...)
+            {
+                state.SetError(std::current_exception());
+            }
+        }
+
+        // Submit 용 상태: 실행할 함수를 상태 안에 보관해 Job 캡처를 포인터 하나로 유지
+        template<typename T, typename Fn>
+        class TaskState final : public FutureState<T>
+        {
+        public:
+            TaskState(ThreadPool* pool, Fn fn) : FutureState<T>(pool), _fn(std::move(fn)) {}
+
+            void Run() { fulfill<T>(*this, _fn); }
+
+        private:
+            Fn _fn;
+        };
+
+        template<typename T, typename F>
+        struct continuation_result { using type = std::invoke_result_t<F&, T&>; };
+
+        template<typename F>
+        struct continuation_result<void, F> { using type = std::invoke_result_t<F&>; };
+    }
+
+    // 비동기 작업 결과
+    // - Get / Wait 는 ThreadPool::WaitUntil 로 도우면서 대기하므로 작업 안에서 호출해도 안전
+    // - 작업에서 던진 예외는 Get 에서 다시 던져진다
+    // - Then 으로 후속 작업을 연결하면 완료 시점에 풀에 등록되므로 워커를 막지 않는다
+    //   앞 단계가 예외로 끝나면 후속 함수는 실행되지 않고 예외만 다음 Future 로 전달된다
+    template<typename T>
+    class Future
+	{
+    public:
+        Future() = default;
+        explicit Future(std::shared_ptr<internal::FutureState<T>> state) : _state(std::move(state)) {}
+
+        bool IsValid() const { return _state != nullptr; }
+        bool IsReady() const { return _state && _state->IsReady(); }
+
+        void Wait() const;
+
+        // 결과 반환 (void 면 대기 + 예외 전달만). 값은 공유 상태에 있으므로 std::move 로 꺼내 갈 수 있다
+        decltype(auto) Get() const;
+
+        // fn(T&) (void 면 fn()) 을 결과로 하는 새 Future
+        template<typename F>
+        auto Then(F&& fn, JobPriority priority = JobPriority::Normal) const
+            -> Future<typename internal::continuation_result<T, std::decay_t<F>>::type>;
+
+        // 성공 / 실패와 관계없이 완료되면 job 을 풀에 등록 (결과는 job 안에서 Get 으로 확인)
+        // Then 과 달리 앞 단계가 예외로 끝나도 실행된다
+        void OnComplete(Job job, JobPriority priority = JobPriority::Normal) const;
+
+    private:
+        std::shared_ptr<internal::FutureState<T>> _state;
+    };
+
+    // Submit 정의는 Future 가 완성된 뒤에 위치 (ThreadPool.hpp 에서 선언)
+    template <typename F>
+    auto ThreadPool::Submit(F&& fn, JobPriority priority) -> Future<std::invoke_result_t<std::decay_t<F>&>>
+    {
+        using T = std::invoke_result_t<std::decay_t<F>&>;
+        using State = internal::TaskState<T, std::decay_t<F>>;
+
+        auto state = std::make_shared<State>(this, std::forward<F>(fn));
+        Enqueue([state] { state->Run(); }, priority);
+        return Future<T>(state);
+    }
+
+    template <typename F>
+    auto ThreadPool::Submit(F&& fn) -> Future<std::invoke_result_t<std::decay_t<F>&>>
+    {
+        return Submit(std::forward<F>(fn), s_RunningDepth > 0 ? s_CurrentPriority : JobPriority::Normal);
+    }
+
+    namespace internal
+    {
+        inline void FutureStateBase::AddContinuation(Job job, JobPriority priority)
+        {
+            {
+                std::lock_guard<std::mutex> lk(_mutex);
+                if (!_ready.load(std::memory_order_relaxed))
+                {
+                    _continuations.push_back({ std::move(job), priority });
+                    return;
+                }
+            }
+            _pool->Enqueue(std::move(job), priority);
+        }
+
+        inline void FutureStateBase::Wait() const
+        {
+            _pool->WaitUntil([this] { return IsReady(); });
+        }
+
+        inline void FutureStateBase::markReady()
+        {
+            std::vector<Continuation> continuations;
+            {
+                std::lock_guard<std::mutex> lk(_mutex);
+                _ready.store(true, std::memory_order_release);
+                continuations.swap(_continuations);
+            }
+
+            for (Continuation& c : continuations)
+                _pool->Enqueue(std::move(c.job), c.priority);
+
+            _pool->NotifyWaiters();
+        }
+    }
+
+    template <typename T>
+    void Future<T>::Wait() const
+    {
+        assert(_state && "Future: 빈 Future");
+        _state->Wait();
+    }
+
+    template <typename T>
+    decltype(auto) Future<T>::Get() const
+    {
+        Wait();
+        if (_state->GetError())
+            std::rethrow_exception(_state->GetError());
+
+        if constexpr (!std::is_void_v<T>)
+            return static_cast<T&>(_state->GetValue());
+    }
+
+    template <typename T>
+    void Future<T>::OnComplete(Job job, JobPriority priority) const
+    {
+        assert(_state && "Future: 빈 Future");
+        _state->AddContinuation(std::move(job), priority);
+    }
+
+    template <typename T>
+    template <typename F>
+    auto Future<T>::Then(F&& fn, JobPriority priority) const
+        -> Future<typename internal::continuation_result<T, std::decay_t<F>>::type>
+    {
+        assert(_state && "Future: 빈 Future");
+
+        using R = typename internal::continuation_result<T, std::decay_t<F>>::type;
+        using Fn = std::decay_t<F>;
+
+        // 후속 함수는 다음 단계 상태에 보관 (Job 캡처는 shared_ptr 두 개)
+        struct ThenState final : internal::FutureState<R>
+        {
+            ThenState(ThreadPool* pool, Fn f) : internal::FutureState<R>(pool), fn(std::move(f)) {}
+            Fn fn;
+        };
+
+        auto parent = _state;
+        auto next = std::make_shared<ThenState>(parent->GetPool(), std::forward<F>(fn));
+
+        parent->AddContinuation([parent, next]
+        {
+            if (parent->GetError())
+            {
+                next->SetError(parent->GetError());
+                return;
+            }
+
+            if constexpr (std::is_void_v<T>)
+                internal::fulfill<R>(*next, next->fn);
+            else
+                internal::fulfill<R>(*next, next->fn, parent->GetValue());
+        }, priority);
+
+        return Future<R>(next);
+    }
+}
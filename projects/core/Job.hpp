@@ -0,0 +1,188 @@
+﻿#pragma once
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+#include "MemoryTracker.hpp"
+
+namespace core
+{
+    class JobCounter;
+
+    // 힙 할당 없는 move-only 작업 타입
+    // 캡처를 내부 버퍼(StorageSize 바이트)에 직접 저장하며, 버퍼보다 큰 캡처는 컴파일 에러
+    // 큰 데이터는 포인터/참조로 캡처하거나 FrameAllocator 에 두고 주소만 넘길 것
+    class Job
+	{
+    public:
+        static constexpr size_t StorageSize = 48;
+
+        Job() noexcept = default;
+
+        template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Job>>>
+        Job(F&& fn);
+
+        Job(Job&& other) noexcept;
+        Job& operator=(Job&& other) noexcept;
+
+        Job(const Job&) = delete;
+        Job& operator=(const Job&) = delete;
+
+        ~Job() { Reset(); }
+
+        void operator()() { _invoke(_storage); }
+        explicit operator bool() const { return _invoke != nullptr; }
+
+        void Reset();
+
+    private:
+        // dst 가 있으면 dst 로 이동 생성 후 src 소멸, 없으면 src 소멸만
+        // (함수 포인터 하나로 합쳐 Job 전체를 64 바이트에 맞춘다)
+        using InvokeFunc = void(*)(void*);
+        using ManageFunc = void(*)(void* dst, void* src);
+
+        alignas(std::max_align_t) std::byte _storage[StorageSize];
+        InvokeFunc  _invoke = nullptr;
+        ManageFunc  _manage = nullptr;
+    };
+
+    static_assert(sizeof(Job) == 64, "Job: 캐시 라인 하나 크기를 유지");
+
+    namespace internal
+    {
+        // 작업 저장 슬롯: 큐에는 슬롯 포인터만 오간다
+        struct JobItem
+        {
+            Job                  fn;
+            JobCounter*          counter = nullptr;
+            uint8_t              priority = 0;       // JobPriority
+            bool                 affinity = false;   // 친화 큐(main/render 등) 작업 여부
+            uint64_t             enqueueNs = 0;      // 통계 수집 중일 때만 기록 (0 이면 미기록)
+            std::atomic<bool>    busy { false };
+        };
+
+        // 미리 할당된 JobItem 링 버퍼
+        // - Allocate 는 소유 스레드(또는 소유 lock 을 잡은 스레드)만 호출
+        // - Free 는 작업을 실행한 아무 스레드나 호출
+        // 커서를 돌며 빈 슬롯을 재사용하고, 한 바퀴 돌아도 빈 슬롯이 없을 때만 블록을 추가한다
+        // 워밍업 이후 정상 상태에서는 힙 할당이 일어나지 않는다
+        class JobSlab
+        {
+        public:
+            explicit JobSlab(size_t blockSize = 1024);
+
+            JobSlab(const JobSlab&) = delete;
+            JobSlab& operator=(const JobSlab&) = delete;
+
+            JobItem* Allocate(Job&& fn, JobCounter* counter);
+            static void Free(JobItem* item);
+
+            size_t GetCapacity() const { return _blocks.size() * _blockSize; }
+
+        private:
+            JobItem& at(size_t index) { return _blocks[index / _blockSize][index % _blockSize]; }
+
+            std::vector<std::unique_ptr<JobItem[]>> _blocks;
+            size_t _blockSize;
+            size_t _cursor = 0;
+        };
+    }
+
+    template <typename F, typename>
+    Job::Job(F&& fn)
+    {
+        using Fn = std::decay_t<F>;
+        static_assert(sizeof(Fn) <= StorageSize, "Job: 캡처가 너무 큽니다. 포인터/참조로 캡처하세요");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t), "Job: 캡처 정렬이 너무 큽니다");
+        static_assert(std::is_nothrow_move_constructible_v<Fn>, "Job: 캡처는 noexcept 로 이동 가능해야 합니다");
+        static_assert(std::is_invocable_v<Fn&>, "Job: void() 형태로 호출 가능해야 합니다");
+
+        new (_storage) Fn(std::forward<F>(fn));
+        _invoke = [](void* p) { (*static_cast<Fn*>(p))(); };
+        _manage = [](void* dst, void* src)
+        {
+            if (dst)
+                new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+            static_cast<Fn*>(src)->~Fn();
+        };
+    }
+
+    inline Job::Job(Job&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    inline Job& Job::operator=(Job&& other) noexcept
+    {
+        if (this == &other)
+            return *this;
+
+        Reset();
+        if (other._invoke)
+        {
+            other._manage(_storage, other._storage);
+            _invoke = other._invoke;
+            _manage = other._manage;
+            other._invoke = nullptr;
+            other._manage = nullptr;
+        }
+        return *this;
+    }
+
+    inline void Job::Reset()
+    {
+        if (_manage)
+            _manage(nullptr, _storage);
+        _invoke = nullptr;
+        _manage = nullptr;
+    }
+
+    namespace internal
+    {
+        inline JobSlab::JobSlab(size_t blockSize) : _blockSize(blockSize)
+        {
+            ScopedMemoryTag memoryTag(MemoryTag::Threading);
+            _blocks.push_back(std::make_unique<JobItem[]>(_blockSize));
+        }
+
+        inline JobItem* JobSlab::Allocate(Job&& fn, JobCounter* counter)
+        {
+            const size_t capacity = GetCapacity();
+            for (size_t tries = 0; tries < capacity; ++tries)
+            {
+                JobItem& item = at(_cursor);
+                _cursor = (_cursor + 1) % capacity;
+
+                if (!item.busy.load(std::memory_order_acquire))
+                {
+                    item.busy.store(true, std::memory_order_relaxed);
+                    item.fn = std::move(fn);
+                    item.counter = counter;
+                    return &item;
+                }
+            }
+
+            // 모든 슬롯이 사용 중: 블록 추가 (용량이 늘어난 뒤로는 재사용)
+            ScopedMemoryTag memoryTag(MemoryTag::Threading);
+            _blocks.push_back(std::make_unique<JobItem[]>(_blockSize));
+            _cursor = capacity + 1;
+
+            JobItem& item = at(capacity);
+            item.busy.store(true, std::memory_order_relaxed);
+            item.fn = std::move(fn);
+            item.counter = counter;
+            return &item;
+        }
+
+        inline void JobSlab::Free(JobItem* item)
+        {
+            item->fn.Reset();
+            item->counter = nullptr;
+            item->busy.store(false, std::memory_order_release);
+        }
+    }
+}
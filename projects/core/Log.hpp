@@ -1,116 +1,938 @@
 ﻿#pragma once
+#include <array>
+#include <mutex>
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
+#include <cctype>
+#include <cassert>
+#include <cstdint>
+#include <string_view>
+#include <condition_variable>
 
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/msvc_sink.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/basic_file_sink.h>
 
+#include "BoundedQueue.hpp"
+#include "CpuTopology.hpp"
+#include "MemoryTracker.hpp"
+
+// 컴파일 시점 최소 로그 수준 (SPDLOG_LEVEL_TRACE ~ SPDLOG_LEVEL_OFF)
+// 이보다 낮은 수준의 호출은 코드가 남지 않는다. CORE_LOG_* 매크로는 인자 평가까지 사라진다
+#ifndef CORE_LOG_MIN_LEVEL
+#if defined(_DEBUG) || !defined(NDEBUG)
+#define CORE_LOG_MIN_LEVEL SPDLOG_LEVEL_TRACE
+#else
+#define CORE_LOG_MIN_LEVEL SPDLOG_LEVEL_INFO
+#endif
+#endif
+
 namespace core
 {
+    constexpr bool IsLogLevelCompiled(spdlog::level::level_enum level) { return level >= CORE_LOG_MIN_LEVEL; }
+
+    // 로그 분류. 분류마다 logger 와 런타임 수준이 따로 있다
+    enum class LogCategory : uint8_t
+    {
+        Core,
+        Graphics,
+        Game,
+        Count
+    };
+
+    constexpr size_t LogCategoryCount = static_cast<size_t>(LogCategory::Count);
+
+    constexpr std::string_view GetLogCategoryName(LogCategory category)
+    {
+        constexpr std::string_view names[LogCategoryCount] = { "Core", "Graphics", "Game" };
+        return static_cast<size_t>(category) < LogCategoryCount ? names[static_cast<size_t>(category)] : "Unknown";
+    }
+
     class ILogSink
-	{
-	public:
-		virtual ~ILogSink() = default;
-		virtual void OnMessage(const std::string& msg, int level) = 0; // 들어온 메시지를 표현하는 사용자 정의 방식
+    {
+    public:
+        virtual ~ILogSink() = default;
+        // 들어온 메시지를 표현하는 사용자 정의 방식 (msg 는 호출 동안만 유효)
+        // 안에서 AddSink/RemoveSink/SetSinkMinLevel 을 호출하면 안 된다 (자기 자신의 읽기 구간이 끝나기를 기다리게 됨)
+        // 디버그 빌드에서는 assert, 릴리스에서는 변경을 무시한다
+        virtual void OnMessage(std::string_view msg, int level) = 0;
+
+        // true 면 로그를 남긴 스레드가 아니라 전용 배달 스레드에서 OnMessage 가 불린다 (에디터 콘솔처럼 느린 sink)
+        // AddSink 시점에 한 번 읽는다. 배달 큐가 가득 차면 메시지를 버린다 (Log::GetDroppedCount)
+        // 배달 스레드가 없을 때(Init 전후)는 로그를 남긴 스레드에서 바로 부른다
+        virtual bool WantsAsync() const { return false; }
+
+        // 이 수준 미만 메시지는 OnMessage 를 부르기 전에 걸러진다
+        // AddSink 시점에 한 번 읽는다. 이후 변경은 Log::SetSinkMinLevel
+        virtual spdlog::level::level_enum GetDefaultMinLevel() const { return spdlog::level::trace; }
     };
 
+    // 비동기 모드에서 큐가 가득 찼을 때의 처리
+    enum class LogOverflowPolicy : uint8_t
+    {
+        Block,      // 자리가 날 때까지 호출 스레드가 잠든다. flush 스레드가 꺼낼 때 깨운다 (유실 없음)
+        DropOldest, // 가장 오래된 메시지를 버리고 넣는다
+        DropNew     // 새 메시지를 버린다 (가장 저렴)
+    };
+
+    struct LogConfig
+    {
+        bool                      async = false;            // true 면 포맷된 메시지를 큐에 넣고 flush 스레드가 sink 에 기록
+        size_t                    queueCapacity = 8192;     // 2의 거듭제곱으로 올림
+        LogOverflowPolicy         overflow = LogOverflowPolicy::Block;
+        std::chrono::milliseconds flushInterval{ 200 };     // 파일 sink flush 주기 (error 이상은 즉시)
+        std::string               filePath = "logs/engine.log";
+        bool                      console = true;           // false 면 파일 sink 만 (벤치마크/서버)
+    };
+
+    namespace internal
+    {
+        // 큐 셀에 미리 만들어 두고 재사용하는 레코드 (text 의 용량이 유지되어 steady state 에서 할당 없음)
+        struct LogRecord
+        {
+            LogCategory                category = LogCategory::Core;
+            spdlog::level::level_enum  level = spdlog::level::info;
+            spdlog::log_clock::time_point time;
+            std::string                text;
+        };
+
+        // 분류별 런타임 수준 (Init 전에는 off)
+        struct LogLevelSlot
+        {
+            std::atomic<spdlog::level::level_enum> value{ spdlog::level::off };
+        };
+
+        // 외부 sink 목록 스냅샷. 바뀔 때마다 통째로 복사해 교체한다 (copy-on-write)
+        struct LogSinkList
+        {
+            struct Entry
+            {
+                std::shared_ptr<ILogSink> sink;
+                bool                      async;    // WantsAsync() 를 AddSink 시점에 캐시
+                spdlog::level::level_enum minLevel; // GetDefaultMinLevel() 로 시작, Log::SetSinkMinLevel 로 변경
+            };
+
+            std::vector<Entry> entries;
+            bool               hasAsync = false;
+        };
+
+        // 읽기 구간 카운터 (두 세대를 번갈아 사용)
+        // 스레드마다 슬롯 하나를 배정해 로그를 남기는 스레드끼리 같은 캐시 라인을 다투지 않는다
+        struct alignas(64) LogSinkReaderSlot
+        {
+            std::array<std::atomic<uint32_t>, 2> count{};
+        };
+
+        constexpr size_t LogSinkReaderSlotCount = 64;
+
+        // 잠든 스레드를 깨우는 신호. 잠든 스레드가 없으면 Notify 는 락을 건드리지 않는다
+        // flush/배달 스레드 하나를 재우거나, Block 정책에서 자리를 기다리는 생산자 여럿을 재운다
+        struct LogWakeSignal
+        {
+            void Notify();
+            // 소비자 종료 등 항상 깨워야 할 때
+            void NotifyAlways();
+            // shouldSleep() 이 락 안에서 true 일 때만 timeout 까지 잔다
+            template<typename Pred>
+            void Wait(std::chrono::milliseconds timeout, Pred&& shouldSleep);
+
+            std::mutex              mutex;
+            std::condition_variable cv;
+            std::atomic<uint32_t>   sleepers{ 0 };
+        };
+
+        // 정적 소멸 시 flush/배달 스레드를 정리 (std::thread 가 joinable 인 채로 파괴되면 terminate)
+        struct LogShutdownGuard
+        {
+            ~LogShutdownGuard();
+        };
+    }
+
+    // Init/Shutdown 은 s_Loggers, s_Queue 같은 일반 정적 변수를 다시 쓴다. 읽는 쪽(Write 등)은 락 없이 읽으므로
+    // Init/Shutdown 은 한 스레드(보통 메인)에서만, 다른 스레드가 로그를 쓰고 있지 않을 때 호출해야 한다
+    // (엔진 시작 직후와 종료 직전. 잡 시스템이 돌고 있는 동안 다시 Init 하지 않는다)
+    class BinaryLog;
+
     class Log {
     public:
-        static void Init();
+        static void Init(const LogConfig& config = {});
+        // 남은 메시지를 모두 기록하고 flush/배달 스레드를 종료 (다른 스레드가 더 이상 로그를 쓰지 않을 때 호출)
+        // echoToText 로 켠 BinaryLog 가 있으면 그쪽을 먼저 Shutdown 해야 한다 (writer 스레드가 Write 를 부름)
+        static void Shutdown();
+        // 큐에 남은 메시지를 호출한 스레드에서 기록하고 logger 를 flush (assert/크래시 처리용)
+        // Shutdown 과 달리 상태를 바꾸거나 스레드를 join 하지 않으므로 어느 스레드에서나 부를 수 있다
+        static void Flush();
+
+        // 외부 sink 목록은 copy-on-write: 변경은 드물고 느려도 되며(락 + 이전 목록을 읽는 스레드 대기),
+        // DispatchToSinks 는 락 없이 현재 스냅샷을 읽는다
         static void AddSink(std::shared_ptr<ILogSink> sink);
-        static void DispatchToSinks(const std::string& msg, int level);
-        static std::shared_ptr<spdlog::logger>& GetLogger() { return s_Logger; }
+        static bool RemoveSink(const std::shared_ptr<ILogSink>& sink);
+        // sink 의 최소 수준 변경 (목록을 새로 게시하므로 AddSink 만큼 느리다). 등록되지 않은 sink 면 false
+        static bool SetSinkMinLevel(const std::shared_ptr<ILogSink>& sink, spdlog::level::level_enum level);
+        static void DispatchToSinks(std::string_view msg, spdlog::level::level_enum level);
+        static std::shared_ptr<spdlog::logger>& GetLogger(LogCategory category = LogCategory::Core) { return s_Loggers[static_cast<size_t>(category)]; }
+
+        // 꺼진 수준의 호출은 이 비교 하나로 끝난다 (Init 전에는 모두 꺼짐)
+        static bool ShouldLog(LogCategory category, spdlog::level::level_enum level)
+        {
+            return IsLogLevelCompiled(level) && level >= s_Levels[static_cast<size_t>(category)].value.load(std::memory_order_relaxed);
+        }
+
+        // 런타임 수준 (CORE_LOG_MIN_LEVEL 아래로는 내려가지 않는다)
+        static void SetLevel(spdlog::level::level_enum level);
+        static void SetLevel(LogCategory category, spdlog::level::level_enum level);
+        // "graphics", "trace" 처럼 이름으로 설정 (설정 파일/콘솔 명령용). 알 수 없는 이름이면 false
+        static bool SetLevel(std::string_view category, std::string_view level);
+        static spdlog::level::level_enum GetLevel(LogCategory category) { return s_Levels[static_cast<size_t>(category)].value.load(std::memory_order_relaxed); }
+
+        // 수준을 먼저 확인하고, 통과하면 스택 버퍼에 한 번만 포맷해 기록
+        template<typename... Args>
+        static void Print(LogCategory category, spdlog::level::level_enum level, fmt::format_string<Args...> fmt, Args&&... args);
+
+        // 포맷이 끝난 메시지를 현재 모드(동기/비동기)에 맞게 기록 (time 은 메시지가 만들어진 시각)
+        static void Write(LogCategory category, spdlog::level::level_enum level, std::string_view msg,
+                          spdlog::log_clock::time_point time = spdlog::log_clock::now());
+
+        static bool IsAsync() { return s_Queue != nullptr; }
+        // 넘침 정책으로 버려진 메시지 수
+        static uint64_t GetDroppedCount() { return s_Dropped.load(std::memory_order_relaxed); }
 
     private:
-        static std::shared_ptr<spdlog::logger> s_Logger {};
-        static std::vector<std::shared_ptr<ILogSink>> s_ExternalSinks {};
+        static int  toSinkLevel(spdlog::level::level_enum level);
+        static void vprint(LogCategory category, spdlog::level::level_enum level, fmt::string_view fmt, fmt::format_args args);
+        static void writeNow(LogCategory category, spdlog::level::level_enum level, spdlog::log_clock::time_point time, std::string_view msg);
+        static void enqueue(LogCategory category, spdlog::level::level_enum level, spdlog::log_clock::time_point time, std::string_view msg);
+        static void flushLoop();
+
+        // 외부 sink (RCU)
+        friend struct internal::LogShutdownGuard;
+        friend class BinaryLog;
+        static internal::LogSinkReaderSlot& sinkReaderSlot();
+        static uint32_t beginSinkRead();
+        static void     endSinkRead(uint32_t epoch);
+        static void     publishSinks(std::unique_ptr<const internal::LogSinkList> list);
+        static void     startSinkThread();
+        static void     stopSinkThread();
+        static void     sinkLoop();
+        static void     drainSinkQueue(const internal::LogSinkList* list);
+        static void     deliverDeferred(const internal::LogSinkList* list, const internal::LogRecord& record);
+
+        // Init/Shutdown 에서만 바뀐다 (클래스 위 주석의 조건 하에서 락 없이 읽음)
+        static inline std::array<std::shared_ptr<spdlog::logger>, LogCategoryCount>        s_Loggers{};
+        static inline std::array<internal::LogLevelSlot, LogCategoryCount>                 s_Levels{};
+
+        static inline std::atomic<const internal::LogSinkList*>     s_Sinks{ nullptr };
+        static inline std::atomic<uint32_t>                         s_SinkEpoch{ 0 };
+        static inline std::array<internal::LogSinkReaderSlot, internal::LogSinkReaderSlotCount> s_SinkReaders{};
+        static inline std::atomic<uint32_t>                         s_SinkReaderNext{ 0 };  // 다음 스레드에 배정할 슬롯
+        static inline thread_local uint32_t                         s_SinkReadDepth = 0;    // 이 스레드가 열어 둔 읽기 구간 수 (재진입 감지)
+        static inline std::mutex                                    s_SinkMutex;    // 쓰기 측 직렬화
+        static inline std::unique_ptr<internal::BoundedQueue<internal::LogRecord>> s_SinkQueue{};  // WantsAsync sink 배달용
+        static inline std::atomic<bool>                             s_SinkThreadRunning{ false };
+        static inline internal::LogWakeSignal                       s_SinkWake;
+        static inline std::thread                                   s_SinkThread;
+
+        // 비동기 백엔드 (s_Queue/s_Overflow/s_FlushInterval 은 Init/Shutdown 에서만 바뀐다)
+        static inline std::unique_ptr<internal::BoundedQueue<internal::LogRecord>> s_Queue{};
+        static inline LogOverflowPolicy         s_Overflow = LogOverflowPolicy::Block;
+        static inline std::chrono::milliseconds s_FlushInterval{ 200 };
+        static inline std::atomic<uint64_t>     s_Dropped{ 0 };
+        static inline std::atomic<bool>         s_Running{ false };
+        static inline internal::LogWakeSignal   s_FlushWake;
+        static inline internal::LogWakeSignal   s_SpaceWake;     // Block 정책에서 자리를 기다리는 생산자
+        static inline size_t                    s_SpaceWakeBatch = 1;   // 큐 용량의 절반 (2의 거듭제곱)
+        static inline std::thread               s_FlushThread;
+        static inline std::atomic<bool>         s_BinaryEcho{ false };  // echoToText BinaryLog 가 켜져 있는 동안 true (Shutdown 순서 확인)
+        static inline internal::LogShutdownGuard s_ShutdownGuard; // 스레드들보다 먼저 파괴되도록 뒤에 선언
     };
 
 #pragma region IMPLEMENTS
-    inline void Log::Init()
+    inline void Log::Init(const LogConfig& config)
     {
+        Shutdown();
+
+        ScopedMemoryTag memoryTag(MemoryTag::Logging);
+
         // 다중 sink 설정
         std::vector<spdlog::sink_ptr> sinks;
 
+        if (config.console)
+        {
 #ifdef _MSC_VER
-        // MSVC 전용 로그 sink
-        sinks.push_back(std::make_shared<spdlog::sinks::msvc_sink_mt>());
+            // MSVC 전용 로그 sink
+            sinks.push_back(std::make_shared<spdlog::sinks::msvc_sink_mt>());
 #else
-        // 일반 콘솔 로그 sink
-        sinks.push_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
+            // 일반 콘솔 로그 sink
+            sinks.push_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
 #endif
+        }
 
         // 로그 파일 출력
-        sinks.push_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>("logs/engine.log", true));
+        sinks.push_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>(config.filePath, true));
+
+        // 분류별 logger 는 sink 를 공유하고 이름(%n)만 다르다. 수준 필터는 s_Levels 가 담당하므로 logger 자체는 모두 통과
+        for (size_t i = 0; i < LogCategoryCount; ++i)
+        {
+            auto logger = std::make_shared<spdlog::logger>(std::string(GetLogCategoryName(static_cast<LogCategory>(i))), sinks.begin(), sinks.end());
+            logger->set_pattern("[%T] [%n] [%^%l%$] %v");
+            logger->set_level(spdlog::level::trace);
+            logger->flush_on(spdlog::level::err);   // 크래시 직전 메시지가 버퍼에 남지 않도록
+            s_Loggers[i] = std::move(logger);
+        }
+        SetLevel(spdlog::level::trace);             // 로그 수준 설정
 
-        s_Logger = std::make_shared<spdlog::logger>("CORE", sinks.begin(), sinks.end());
-        s_Logger->set_pattern("[%T] [%^%l%$] %v");
-        s_Logger->set_level(spdlog::level::trace);  // 로그 수준 설정
+        startSinkThread();
+
+        if (!config.async)
+            return;
+
+        s_Queue = std::make_unique<internal::BoundedQueue<internal::LogRecord>>(config.queueCapacity);
+        s_Overflow = config.overflow;
+        s_SpaceWakeBatch = s_Queue->Capacity() / 2;
+        s_FlushInterval = config.flushInterval;
+        s_Running.store(true, std::memory_order_release);
+        s_FlushThread = std::thread(&Log::flushLoop);
+    }
+
+    inline void Log::Shutdown()
+    {
+        assert(!s_BinaryEcho.load(std::memory_order_acquire) && "Log: echoToText BinaryLog 를 먼저 Shutdown 해야 함");
+
+        if (s_Queue)
+        {
+            s_Running.store(false, std::memory_order_release);
+            s_FlushWake.NotifyAlways();
+            if (s_FlushThread.joinable())
+                s_FlushThread.join();
+
+            s_Queue.reset();
+            for (auto& logger : s_Loggers)
+                if (logger)
+                    logger->flush();
+        }
+
+        // flush 스레드가 마지막으로 넘긴 메시지까지 배달한 뒤 종료
+        stopSinkThread();
+    }
+
+    inline void Log::Flush()
+    {
+        if (s_Queue)
+        {
+            ScopedMemoryTag memoryTag(MemoryTag::Logging);
+
+            // flush 스레드와 같이 꺼내도 큐가 MPMC 이므로 레코드마다 한 쪽에서만 기록된다
+            // (flush 스레드가 이미 꺼내 기록 중인 레코드는 기다리지 않는다)
+            internal::LogRecord record;
+            auto take = [&](internal::LogRecord& cell)
+            {
+                record.category = cell.category;
+                record.level = cell.level;
+                record.time = cell.time;
+                record.text.swap(cell.text);
+            };
+            while (s_Queue->TryPop(take))
+                writeNow(record.category, record.level, record.time, record.text);
+            s_SpaceWake.Notify();
+        }
+
+        for (auto& logger : s_Loggers)
+            if (logger)
+                logger->flush();
     }
 
     inline void Log::AddSink(std::shared_ptr<ILogSink> sink)
     {
-        s_ExternalSinks.push_back(std::move(sink));
+        assert(s_SinkReadDepth == 0 && "Log: sink 의 OnMessage 안에서 AddSink 호출");
+        if (!sink || s_SinkReadDepth != 0)
+            return;
+
+        {
+            std::lock_guard<std::mutex> lock(s_SinkMutex);
+            ScopedMemoryTag memoryTag(MemoryTag::Logging);
+
+            const internal::LogSinkList* current = s_Sinks.load(std::memory_order_acquire);
+            auto list = current ? std::make_unique<internal::LogSinkList>(*current) : std::make_unique<internal::LogSinkList>();
+            const bool async = sink->WantsAsync();
+            const spdlog::level::level_enum minLevel = sink->GetDefaultMinLevel();
+            list->entries.push_back({ std::move(sink), async, minLevel });
+            list->hasAsync |= async;
+            publishSinks(std::move(list));
+        }
+
+        // Init 전이면 Init 이 시작한다
+        if (s_Loggers[0])
+            startSinkThread();
+    }
+
+    inline bool Log::RemoveSink(const std::shared_ptr<ILogSink>& sink)
+    {
+        assert(s_SinkReadDepth == 0 && "Log: sink 의 OnMessage 안에서 RemoveSink 호출");
+        if (s_SinkReadDepth != 0)
+            return false;
+
+        std::lock_guard<std::mutex> lock(s_SinkMutex);
+        ScopedMemoryTag memoryTag(MemoryTag::Logging);
+
+        const internal::LogSinkList* current = s_Sinks.load(std::memory_order_acquire);
+        if (!current)
+            return false;
+
+        auto list = std::make_unique<internal::LogSinkList>();
+        bool removed = false;
+        for (const auto& entry : current->entries)
+        {
+            if (entry.sink == sink)
+            {
+                removed = true;
+                continue;
+            }
+            list->entries.push_back(entry);
+            list->hasAsync |= entry.async;
+        }
+
+        if (removed)
+            publishSinks(std::move(list));
+        // publishSinks 가 읽는 스레드를 기다렸으므로 반환 후에는 sink 가 더 이상 불리지 않는다
+        return removed;
+    }
+
+    inline bool Log::SetSinkMinLevel(const std::shared_ptr<ILogSink>& sink, spdlog::level::level_enum level)
+    {
+        assert(s_SinkReadDepth == 0 && "Log: sink 의 OnMessage 안에서 SetSinkMinLevel 호출");
+        if (s_SinkReadDepth != 0)
+            return false;
+
+        std::lock_guard<std::mutex> lock(s_SinkMutex);
+        ScopedMemoryTag memoryTag(MemoryTag::Logging);
+
+        const internal::LogSinkList* current = s_Sinks.load(std::memory_order_acquire);
+        if (!current)
+            return false;
+
+        auto list = std::make_unique<internal::LogSinkList>(*current);
+        bool found = false;
+        for (auto& entry : list->entries)
+        {
+            if (entry.sink == sink)
+            {
+                entry.minLevel = level;
+                found = true;
+            }
+        }
+
+        if (found)
+            publishSinks(std::move(list));
+        return found;
+    }
+
+    inline void Log::DispatchToSinks(std::string_view msg, spdlog::level::level_enum level)
+    {
+        // sink 가 없으면 읽기 구간도 열지 않는다
+        if (!s_Sinks.load(std::memory_order_relaxed))
+            return;
+
+        const uint32_t epoch = beginSinkRead();
+        const internal::LogSinkList* list = s_Sinks.load(std::memory_order_acquire);
+        if (list)
+        {
+            const int sinkLevel = toSinkLevel(level);
+            // 배달 스레드가 없으면 (Init 전, Shutdown 후) 느린 sink 도 여기서 부른다. 말없이 버리지 않는다
+            const bool threadRunning = list->hasAsync && s_SinkThreadRunning.load(std::memory_order_acquire);
+            bool deferred = false;
+            for (const auto& entry : list->entries)
+            {
+                if (level < entry.minLevel)
+                    continue;
+
+                if (entry.async && threadRunning)
+                    deferred = true;
+                else
+                    entry.sink->OnMessage(msg, sinkLevel);
+            }
+
+            // 느린 sink 는 배달 스레드에 맡긴다. 절대 기다리지 않는다
+            if (deferred)
+            {
+                const bool pushed = s_SinkQueue->TryPush([&](internal::LogRecord& record)
+                {
+                    record.level = level;
+                    record.text.assign(msg.data(), msg.size());
+                });
+
+                if (!pushed)
+                {
+                    s_Dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+                else
+                {
+                    // 위에서 스레드가 돌고 있는 것을 본 뒤 stopSinkThread 가 끝났다면 이 레코드를 꺼낼 스레드가 없다
+                    // push 와 확인 사이의 fence 가 stopSinkThread 의 fence 와 짝을 이뤄, 둘 중 하나는 반드시 큐를 비운다
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (s_SinkThreadRunning.load(std::memory_order_relaxed))
+                        s_SinkWake.Notify();
+                    else
+                        drainSinkQueue(list);
+                }
+            }
+        }
+        endSinkRead(epoch);
+    }
+
+    inline internal::LogSinkReaderSlot& Log::sinkReaderSlot()
+    {
+        // 처음 읽을 때 배정. 스레드가 슬롯 수보다 많으면 몇몇 스레드가 슬롯을 나눠 쓴다
+        static thread_local const uint32_t index = s_SinkReaderNext.fetch_add(1, std::memory_order_relaxed) % internal::LogSinkReaderSlotCount;
+        return s_SinkReaders[index];
+    }
+
+    inline uint32_t Log::beginSinkRead()
+    {
+        // 이 스레드 슬롯의 현재 세대 카운터에 등록한 뒤 세대가 그대로인지 확인 (바뀌었다면 새 세대로 다시 등록)
+        internal::LogSinkReaderSlot& slot = sinkReaderSlot();
+        ++s_SinkReadDepth;
+        for (;;)
+        {
+            const uint32_t epoch = s_SinkEpoch.load(std::memory_order_acquire) & 1;
+            slot.count[epoch].fetch_add(1, std::memory_order_seq_cst);
+            if ((s_SinkEpoch.load(std::memory_order_seq_cst) & 1) == epoch)
+                return epoch;
+            slot.count[epoch].fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    inline void Log::endSinkRead(uint32_t epoch)
+    {
+        sinkReaderSlot().count[epoch].fetch_sub(1, std::memory_order_release);
+        --s_SinkReadDepth;
+    }
+
+    inline void Log::publishSinks(std::unique_ptr<const internal::LogSinkList> list)
+    {
+        // s_SinkMutex 안에서 호출
+        std::unique_ptr<const internal::LogSinkList> previous(s_Sinks.exchange(list.release(), std::memory_order_acq_rel));
+
+        // 유예 기간: 세대를 넘기고, 이전 세대에 등록된 읽기 구간이 모두 끝나면 이전 목록을 해제
+        // 이전 목록을 읽었을 수 있는 스레드는 모두 이전 세대 카운터에 있다
+        // 목록 변경은 드물므로 모든 슬롯을 훑는 비용은 쓰기 측이 진다
+        const uint32_t epoch = s_SinkEpoch.fetch_add(1, std::memory_order_seq_cst) & 1;
+        for (const internal::LogSinkReaderSlot& slot : s_SinkReaders)
+            while (slot.count[epoch].load(std::memory_order_seq_cst) != 0)
+                std::this_thread::yield();
+    }
+
+    inline void Log::startSinkThread()
+    {
+        const internal::LogSinkList* list = s_Sinks.load(std::memory_order_acquire);
+        if (!list || !list->hasAsync || s_SinkThreadRunning.load(std::memory_order_acquire))
+            return;
+
+        std::lock_guard<std::mutex> lock(s_SinkMutex);
+        if (s_SinkThreadRunning.load(std::memory_order_relaxed))
+            return;
+
+        ScopedMemoryTag memoryTag(MemoryTag::Logging);
+        if (!s_SinkQueue)
+            s_SinkQueue = std::make_unique<internal::BoundedQueue<internal::LogRecord>>(1024);
+        s_SinkThreadRunning.store(true, std::memory_order_release);
+        s_SinkThread = std::thread(&Log::sinkLoop);
+    }
+
+    inline void Log::stopSinkThread()
+    {
+        if (!s_SinkThreadRunning.exchange(false, std::memory_order_acq_rel))
+            return;
+
+        s_SinkWake.NotifyAlways();
+        if (s_SinkThread.joinable())
+            s_SinkThread.join();
+
+        // 배달 스레드가 끝나기 직전에 들어온 레코드. DispatchToSinks 의 fence 와 짝을 이룬다
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const uint32_t epoch = beginSinkRead();
+        drainSinkQueue(s_Sinks.load(std::memory_order_acquire));
+        endSinkRead(epoch);
+    }
+
+    inline void Log::sinkLoop()
+    {
+        ScopedMemoryTag memoryTag(MemoryTag::Logging);
+        SetCurrentThreadName("LogSinks");
+
+        internal::LogRecord record;
+        auto take = [&](internal::LogRecord& cell)
+        {
+            record.level = cell.level;
+            record.text.swap(cell.text);
+        };
+
+        for (;;)
+        {
+            size_t delivered = 0;
+            while (s_SinkQueue->TryPop(take))
+            {
+                const uint32_t epoch = beginSinkRead();
+                deliverDeferred(s_Sinks.load(std::memory_order_acquire), record);
+                endSinkRead(epoch);
+                ++delivered;
+            }
+
+            if (delivered > 0)
+                continue;
+
+            if (!s_SinkThreadRunning.load(std::memory_order_acquire) && s_SinkQueue->Size() == 0)
+                break;
+
+            s_SinkWake.Wait(std::chrono::milliseconds(200), []
+            {
+                return s_SinkQueue->Size() == 0 && s_SinkThreadRunning.load(std::memory_order_acquire);
+            });
+        }
+    }
+
+    inline void Log::drainSinkQueue(const internal::LogSinkList* list)
+    {
+        // 읽기 구간 안에서 호출 (list 는 그 구간에서 읽은 스냅샷)
+        ScopedMemoryTag memoryTag(MemoryTag::Logging);
+
+        internal::LogRecord record;
+        auto take = [&](internal::LogRecord& cell)
+        {
+            record.level = cell.level;
+            record.text.swap(cell.text);
+        };
+        while (s_SinkQueue->TryPop(take))
+            deliverDeferred(list, record);
+    }
+
+    inline void Log::deliverDeferred(const internal::LogSinkList* list, const internal::LogRecord& record)
+    {
+        if (!list)
+            return;
+
+        const int sinkLevel = toSinkLevel(record.level);
+        for (const auto& entry : list->entries)
+            if (entry.async && record.level >= entry.minLevel)
+                entry.sink->OnMessage(record.text, sinkLevel);
+    }
+
+    inline void Log::SetLevel(spdlog::level::level_enum level)
+    {
+        for (size_t i = 0; i < LogCategoryCount; ++i)
+            SetLevel(static_cast<LogCategory>(i), level);
+    }
+
+    inline void Log::SetLevel(LogCategory category, spdlog::level::level_enum level)
+    {
+        s_Levels[static_cast<size_t>(category)].value.store(level, std::memory_order_relaxed);
+    }
+
+    inline bool Log::SetLevel(std::string_view category, std::string_view level)
+    {
+        auto equalsNoCase = [](std::string_view a, std::string_view b)
+        {
+            if (a.size() != b.size())
+                return false;
+            for (size_t i = 0; i < a.size(); ++i)
+                if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i])))
+                    return false;
+            return true;
+        };
+
+        // from_str 는 모르는 이름에 off 를 돌려준다
+        const spdlog::level::level_enum value = spdlog::level::from_str(std::string(level));
+        if (value == spdlog::level::off && level != "off")
+            return false;
+
+        for (size_t i = 0; i < LogCategoryCount; ++i)
+        {
+            if (equalsNoCase(category, GetLogCategoryName(static_cast<LogCategory>(i))))
+            {
+                SetLevel(static_cast<LogCategory>(i), value);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<typename... Args>
+    void Log::Print(LogCategory category, spdlog::level::level_enum level, fmt::format_string<Args...> fmt, Args&&... args)
+    {
+        if (!ShouldLog(category, level))
+            return;
+        vprint(category, level, fmt.get(), fmt::make_format_args(args...));
+    }
+
+    inline void Log::vprint(LogCategory category, spdlog::level::level_enum level, fmt::string_view fmt, fmt::format_args args)
+    {
+        // 500 바이트까지는 스택에서 끝난다 (sink 안에서 다시 로그를 남겨도 안전하도록 thread_local 대신 스택)
+        fmt::memory_buffer buffer;
+        fmt::vformat_to(fmt::appender(buffer), fmt, args);
+        Write(category, level, std::string_view(buffer.data(), buffer.size()));
+    }
+
+    inline void Log::Write(LogCategory category, spdlog::level::level_enum level, std::string_view msg, spdlog::log_clock::time_point time)
+    {
+        if (!ShouldLog(category, level) || !s_Loggers[static_cast<size_t>(category)])
+            return;
+
+        if (s_Queue)
+            enqueue(category, level, time, msg);
+        else
+            writeNow(category, level, time, msg);
+    }
+
+    inline int Log::toSinkLevel(spdlog::level::level_enum level)
+    {
+        // ILogSink 수준: 1 trace, 2 info, 3 warn, 4 error, 5 critical
+        switch (level)
+        {
+        case spdlog::level::trace:
+        case spdlog::level::debug:    return 1;
+        case spdlog::level::info:     return 2;
+        case spdlog::level::warn:     return 3;
+        case spdlog::level::err:      return 4;
+        default:                      return 5;
+        }
+    }
+
+    inline void Log::writeNow(LogCategory category, spdlog::level::level_enum level, spdlog::log_clock::time_point time, std::string_view msg)
+    {
+        // 호출 시점의 시각을 유지 (비동기 모드에서는 flush 스레드가 늦게 기록하므로)
+        // 이미 포맷된 문자열이므로 포맷 없는 오버로드로 넘긴다
+        s_Loggers[static_cast<size_t>(category)]->log(time, spdlog::source_loc{}, level, spdlog::string_view_t(msg.data(), msg.size()));
+        DispatchToSinks(msg, level);
     }
 
-    inline void Log::DispatchToSinks(const std::string& msg, int level)
+    inline void Log::enqueue(LogCategory category, spdlog::level::level_enum level, spdlog::log_clock::time_point time, std::string_view msg)
     {
-        for (auto& sink : s_ExternalSinks)
-            if (sink)
-                sink->OnMessage(msg, level);
+        auto fill = [&](internal::LogRecord& record)
+        {
+            record.category = category;
+            record.level = level;
+            record.time = time;
+            record.text.assign(msg.data(), msg.size());
+        };
+
+        while (!s_Queue->TryPush(fill))
+        {
+            switch (s_Overflow)
+            {
+            case LogOverflowPolicy::DropNew:
+                s_Dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+
+            case LogOverflowPolicy::DropOldest:
+                // flush 스레드와 경쟁해도 큐가 MPMC 이므로 안전. 이미 비워졌다면 그냥 다시 시도
+                if (s_Queue->TryPop([](internal::LogRecord&) {}))
+                    s_Dropped.fetch_add(1, std::memory_order_relaxed);
+                break;
+
+            case LogOverflowPolicy::Block:
+                // 돌면서 flush 스레드와 코어를 다투지 않도록 잠든다. flush 스레드가 레코드를 꺼낼 때마다 깨운다
+                // (timeout 은 Size() 가 근사치라 놓친 경우의 안전장치)
+                s_FlushWake.Notify();
+                s_SpaceWake.Wait(std::chrono::milliseconds(1), []
+                {
+                    return s_Queue->Size() >= s_Queue->Capacity();
+                });
+                break;
+            }
+        }
+
+        s_FlushWake.Notify();
+    }
+
+    inline void Log::flushLoop()
+    {
+        ScopedMemoryTag memoryTag(MemoryTag::Logging);
+        SetCurrentThreadName("LogFlush");
+
+        using clock = std::chrono::steady_clock;
+        auto lastFlush = clock::now();
+        bool dirty = false;
+
+        // 셀과 문자열을 맞바꿔 I/O 동안 셀을 붙잡지 않는다 (두 버퍼의 용량이 계속 순환)
+        internal::LogRecord record;
+        auto take = [&](internal::LogRecord& cell)
+        {
+            record.category = cell.category;
+            record.level = cell.level;
+            record.time = cell.time;
+            record.text.swap(cell.text);
+        };
+
+        for (;;)
+        {
+            size_t written = 0;
+            while (s_Queue->TryPop(take))
+            {
+                writeNow(record.category, record.level, record.time, record.text);
+                // Block 정책으로 잠든 생산자는 큐의 절반이 비었을 때 한꺼번에 깨운다
+                // (한 칸마다 깨우면 생산자들이 깨어나 락을 다투는 동안 flush 스레드가 밀리고, 다시 가득 차 잠든다)
+                if ((++written & (s_SpaceWakeBatch - 1)) == 0)
+                    s_SpaceWake.Notify();
+            }
+            s_SpaceWake.Notify();
+            dirty |= written > 0;
+
+            const auto now = clock::now();
+            if (dirty && now - lastFlush >= s_FlushInterval)
+            {
+                // 분류별 logger 가 sink 를 공유하므로 하나만 flush 해도 모든 sink 가 비워진다
+                s_Loggers[0]->flush();
+                lastFlush = now;
+                dirty = false;
+            }
+
+            if (written > 0)
+                continue;
+
+            if (!s_Running.load(std::memory_order_acquire) && s_Queue->Size() == 0)
+                break;
+
+            s_FlushWake.Wait(s_FlushInterval, []
+            {
+                return s_Queue->Size() == 0 && s_Running.load(std::memory_order_acquire);
+            });
+        }
+
+        s_Loggers[0]->flush();
+    }
+
+    inline void internal::LogWakeSignal::Notify()
+    {
+        // Wait 의 sleepers 증가 -> 큐 확인 과 짝을 이루는 fence (둘 중 하나는 반드시 상대를 본다)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepers.load(std::memory_order_relaxed) == 0)
+            return;
+
+        // 잠든 상태에서만 락을 잡는다 (바쁜 동안에는 생산자가 락을 건드리지 않음)
+        NotifyAlways();
+    }
+
+    inline void internal::LogWakeSignal::NotifyAlways()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_all();
+    }
+
+    template<typename Pred>
+    void internal::LogWakeSignal::Wait(std::chrono::milliseconds timeout, Pred&& shouldSleep)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        sleepers.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (shouldSleep())
+            cv.wait_for(lock, timeout);
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    inline internal::LogShutdownGuard::~LogShutdownGuard()
+    {
+        Log::Shutdown();
+
+        // 남은 sink 목록 해제
+        std::lock_guard<std::mutex> lock(Log::s_SinkMutex);
+        Log::publishSinks(nullptr);
     }
 #pragma endregion
 
 #pragma region LOG_FUNCS
-    // 전역 출력 래퍼
+    // 전역 출력 래퍼. 분류를 생략하면 LogCategory::Core
+    // CORE_LOG_MIN_LEVEL 아래 수준은 본문이 비어 호출이 사라진다 (인자 평가는 남으므로 비싼 인자는 CORE_LOG_* 매크로 사용)
+    template<typename... Args>
+    void LogTrace(LogCategory category, fmt::format_string<Args...> fmt, Args&&... args)
+    {
+        if constexpr (IsLogLevelCompiled(spdlog::level::trace))
+            Log::Print(category, spdlog::level::trace, fmt, std::forward<Args>(args)...);
+    }
+
     template<typename... Args>
     void LogTrace(fmt::format_string<Args...> fmt, Args&&... args)
-	{
-		const std::string msg = fmt::format(fmt, std::forward<Args>(args)...);
-        Log::GetLogger()->trace(msg);
-        Log::DispatchToSinks(msg, 1);
+    {
+        LogTrace(LogCategory::Core, fmt, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    void LogDebug(LogCategory category, fmt::format_string<Args...> fmt, Args&&... args)
+    {
+        if constexpr (IsLogLevelCompiled(spdlog::level::debug))
+            Log::Print(category, spdlog::level::debug, fmt, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    void LogDebug(fmt::format_string<Args...> fmt, Args&&... args)
+    {
+        LogDebug(LogCategory::Core, fmt, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    void LogInfo(LogCategory category, fmt::format_string<Args...> fmt, Args&&... args)
+    {
+        if constexpr (IsLogLevelCompiled(spdlog::level::info))
+            Log::Print(category, spdlog::level::info, fmt, std::forward<Args>(args)...);
     }
 
     template<typename... Args>
     void LogInfo(fmt::format_string<Args...> fmt, Args&&... args)
-	{
-		const std::string msg = fmt::format(fmt, std::forward<Args>(args)...);
-        Log::GetLogger()->info(msg);
-        Log::DispatchToSinks(msg, 2);
+    {
+        LogInfo(LogCategory::Core, fmt, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    void LogWarn(LogCategory category, fmt::format_string<Args...> fmt, Args&&... args)
+    {
+        if constexpr (IsLogLevelCompiled(spdlog::level::warn))
+            Log::Print(category, spdlog::level::warn, fmt, std::forward<Args>(args)...);
     }
 
     template<typename... Args>
     void LogWarn(fmt::format_string<Args...> fmt, Args&&... args)
-	{
-		const std::string msg = fmt::format(fmt, std::forward<Args>(args)...);
-        Log::GetLogger()->warn(msg);
-        Log::DispatchToSinks(msg, 3);
+    {
+        LogWarn(LogCategory::Core, fmt, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    void LogError(LogCategory category, fmt::format_string<Args...> fmt, Args&&... args)
+    {
+        if constexpr (IsLogLevelCompiled(spdlog::level::err))
+            Log::Print(category, spdlog::level::err, fmt, std::forward<Args>(args)...);
     }
 
     template<typename... Args>
     void LogError(fmt::format_string<Args...> fmt, Args&&... args)
-	{
-		const std::string msg = fmt::format(fmt, std::forward<Args>(args)...);
-        Log::GetLogger()->error(msg);
-        Log::DispatchToSinks(msg, 4);
+    {
+        LogError(LogCategory::Core, fmt, std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    void LogCritical(LogCategory category, fmt::format_string<Args...> fmt, Args&&... args)
+    {
+        if constexpr (IsLogLevelCompiled(spdlog::level::critical))
+            Log::Print(category, spdlog::level::critical, fmt, std::forward<Args>(args)...);
     }
 
     template<typename... Args>
     void LogCritical(fmt::format_string<Args...> fmt, Args&&... args)
-	{
-		const std::string msg = fmt::format(fmt, std::forward<Args>(args)...);
-        Log::GetLogger()->critical(msg);
-        Log::DispatchToSinks(msg, 5);
+    {
+        LogCritical(LogCategory::Core, fmt, std::forward<Args>(args)...);
     }
 
     template<typename... Args>
     void AssertFormat(bool condition, fmt::format_string<Args...> fmt, Args&&... args)
-	{
+    {
         if (!condition) 
         {
-            std::string msg = fmt::format(fmt, std::forward<Args>(args)...);
-            LogError("Assertion Failed: {}", msg);
+            fmt::memory_buffer msg;
+            fmt::format_to(fmt::appender(msg), fmt, std::forward<Args>(args)...);
+            LogError("Assertion Failed: {}", std::string_view(msg.data(), msg.size()));
+            Log::Flush();       // 중단 전에 큐에 남은 메시지를 기록 (Shutdown 은 Init 한 스레드 전용이라 부르지 않는다)
 #ifdef _MSC_VER
             __debugbreak();
 #else
@@ -120,9 +942,45 @@ namespace core
     }
 
 #ifdef _DEBUG
-	#define CORE_ASSERT(x, ...) ::core::AssertFormat((x), __VA_ARGS__)
+    #define CORE_ASSERT(x, ...) ::core::AssertFormat((x), __VA_ARGS__)
+#else
+    #define CORE_ASSERT(x, ...)
+#endif
+
+    // 분류 이름만 적는 매크로 버전: CORE_LOG_INFO(Graphics, "{} draws", count)
+    // 수준이 꺼져 있으면 인자를 평가하지 않고, CORE_LOG_MIN_LEVEL 아래면 코드 자체가 없다
+#define CORE_LOG_IMPL(category, level, ...) \
+    do { if (::core::Log::ShouldLog(::core::LogCategory::category, (level))) ::core::Log::Print(::core::LogCategory::category, (level), __VA_ARGS__); } while (0)
+
+#if CORE_LOG_MIN_LEVEL <= SPDLOG_LEVEL_TRACE
+    #define CORE_LOG_TRACE(category, ...) CORE_LOG_IMPL(category, spdlog::level::trace, __VA_ARGS__)
+#else
+    #define CORE_LOG_TRACE(category, ...) ((void)0)
+#endif
+#if CORE_LOG_MIN_LEVEL <= SPDLOG_LEVEL_DEBUG
+    #define CORE_LOG_DEBUG(category, ...) CORE_LOG_IMPL(category, spdlog::level::debug, __VA_ARGS__)
+#else
+    #define CORE_LOG_DEBUG(category, ...) ((void)0)
+#endif
+#if CORE_LOG_MIN_LEVEL <= SPDLOG_LEVEL_INFO
+    #define CORE_LOG_INFO(category, ...) CORE_LOG_IMPL(category, spdlog::level::info, __VA_ARGS__)
+#else
+    #define CORE_LOG_INFO(category, ...) ((void)0)
+#endif
+#if CORE_LOG_MIN_LEVEL <= SPDLOG_LEVEL_WARN
+    #define CORE_LOG_WARN(category, ...) CORE_LOG_IMPL(category, spdlog::level::warn, __VA_ARGS__)
+#else
+    #define CORE_LOG_WARN(category, ...) ((void)0)
+#endif
+#if CORE_LOG_MIN_LEVEL <= SPDLOG_LEVEL_ERROR
+    #define CORE_LOG_ERROR(category, ...) CORE_LOG_IMPL(category, spdlog::level::err, __VA_ARGS__)
+#else
+    #define CORE_LOG_ERROR(category, ...) ((void)0)
+#endif
+#if CORE_LOG_MIN_LEVEL <= SPDLOG_LEVEL_CRITICAL
+    #define CORE_LOG_CRITICAL(category, ...) CORE_LOG_IMPL(category, spdlog::level::critical, __VA_ARGS__)
 #else
-	#define CORE_ASSERT(x, ...)
+    #define CORE_LOG_CRITICAL(category, ...) ((void)0)
 #endif
 #pragma endregion
 }
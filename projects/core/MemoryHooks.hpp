@@ -0,0 +1,88 @@
+﻿#pragma once
+// 계측 빌드용 전역 new/delete 훅
+// CORE_MEMORY_TRACKING 을 정의한 빌드에서, 실행 파일의 .cpp 한 곳에서만 include 할 것 (operator new 교체는 프로그램에 하나만 존재해야 함)
+// 정의하지 않으면 아무것도 하지 않는다
+#if defined(CORE_MEMORY_TRACKING)
+#include <new>
+#include <cstdlib>
+#include <cstdint>
+#include <cstddef>
+
+#include "MemoryTracker.hpp"
+
+namespace core
+{
+    namespace internal
+    {
+        // 사용자 블록 바로 앞에 두는 헤더: 해제 시 크기/태그를 알아야 하므로
+        struct alignas(std::max_align_t) TrackedHeader
+        {
+            void*     raw;      // malloc 이 돌려준 원래 주소
+            size_t    size;
+            MemoryTag tag;
+        };
+
+        inline void* tracked_alloc(size_t size, size_t alignment) noexcept
+        {
+            if (alignment < alignof(std::max_align_t)) alignment = alignof(std::max_align_t);
+
+            void* raw = std::malloc(size + sizeof(TrackedHeader) + alignment);
+            if (!raw) return nullptr;
+
+            const std::uintptr_t user = (reinterpret_cast<std::uintptr_t>(raw) + sizeof(TrackedHeader) + alignment - 1) & ~(alignment - 1);
+            auto* header = reinterpret_cast<TrackedHeader*>(user) - 1;
+            header->raw = raw;
+            header->size = size;
+            header->tag = MemoryTracker::GetCurrentTag();
+
+            MemoryTracker::RecordAlloc(header->tag, size);
+            return reinterpret_cast<void*>(user);
+        }
+
+        inline void tracked_free(void* p) noexcept
+        {
+            if (!p) return;
+
+            auto* header = static_cast<TrackedHeader*>(p) - 1;
+            // 다른 스레드/태그에서 해제되어도 할당 당시 태그로 돌려준다
+            MemoryTracker::RecordFree(header->tag, header->size);
+            std::free(header->raw);
+        }
+
+        inline void* tracked_new(size_t size, size_t alignment)
+        {
+            for (;;)
+            {
+                if (void* p = tracked_alloc(size == 0 ? 1 : size, alignment))
+                    return p;
+
+                std::new_handler handler = std::get_new_handler();
+                if (!handler) throw std::bad_alloc();
+                handler();
+            }
+        }
+    }
+}
+
+void* operator new(std::size_t size) { return core::internal::tracked_new(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](std::size_t size) { return core::internal::tracked_new(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(std::size_t size, std::align_val_t al) { return core::internal::tracked_new(size, static_cast<size_t>(al)); }
+void* operator new[](std::size_t size, std::align_val_t al) { return core::internal::tracked_new(size, static_cast<size_t>(al)); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return core::internal::tracked_alloc(size == 0 ? 1 : size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return core::internal::tracked_alloc(size == 0 ? 1 : size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept { return core::internal::tracked_alloc(size == 0 ? 1 : size, static_cast<size_t>(al)); }
+void* operator new[](std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept { return core::internal::tracked_alloc(size == 0 ? 1 : size, static_cast<size_t>(al)); }
+
+void operator delete(void* p) noexcept { core::internal::tracked_free(p); }
+void operator delete[](void* p) noexcept { core::internal::tracked_free(p); }
+void operator delete(void* p, std::size_t) noexcept { core::internal::tracked_free(p); }
+void operator delete[](void* p, std::size_t) noexcept { core::internal::tracked_free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { core::internal::tracked_free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { core::internal::tracked_free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { core::internal::tracked_free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { core::internal::tracked_free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { core::internal::tracked_free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { core::internal::tracked_free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { core::internal::tracked_free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { core::internal::tracked_free(p); }
+#endif
@@ -0,0 +1,217 @@
+﻿#pragma once
+#include <array>
+#include <atomic>
+#include <string>
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+#include <string_view>
+
+namespace core
+{
+    // 메모리 사용처 분류. 전역 new/delete 훅(MemoryHooks.hpp)은 현재 스레드의 ScopedMemoryTag 를 따른다
+    enum class MemoryTag : uint8_t
+    {
+        General,
+        Graphics,
+        FrameArena,
+        Logging,
+        Threading,
+        Game,
+        Count
+    };
+
+    constexpr size_t MemoryTagCount = static_cast<size_t>(MemoryTag::Count);
+
+    constexpr std::string_view GetMemoryTagName(MemoryTag tag)
+    {
+        constexpr std::string_view names[MemoryTagCount] = { "General", "Graphics", "FrameArena", "Logging", "Threading", "Game" };
+        return static_cast<size_t>(tag) < MemoryTagCount ? names[static_cast<size_t>(tag)] : "Unknown";
+    }
+
+    struct MemoryTagStats
+    {
+        int64_t current = 0;        // 현재 할당된 바이트
+        int64_t peak = 0;           // 최대 current
+        int64_t allocCount = 0;
+        int64_t freeCount = 0;
+        int64_t arenaHighWater = 0; // 이 태그 아레나들이 한 프레임에 실제로 사용한 최대량
+    };
+
+    struct MemorySnapshot
+    {
+        std::array<MemoryTagStats, MemoryTagCount> tags{};
+
+        // after - before (peak/arenaHighWater 도 차이로 표시)
+        static MemorySnapshot Diff(const MemorySnapshot& before, const MemorySnapshot& after);
+
+        std::string ToString() const;
+    };
+
+    namespace internal
+    {
+        // 태그 하나의 카운터 (태그끼리 캐시 라인 공유 방지)
+        struct alignas(64) MemoryTagCounters
+        {
+            std::atomic<int64_t> current{ 0 };
+            std::atomic<int64_t> peak{ 0 };
+            std::atomic<int64_t> allocCount{ 0 };
+            std::atomic<int64_t> freeCount{ 0 };
+            std::atomic<int64_t> arenaHighWater{ 0 };
+            std::atomic<int64_t> budget{ 0 };
+            std::atomic<bool>    overBudget{ false };
+        };
+    }
+
+    // 태그별 예산 초과 시 호출 (current 가 예산 아래로 내려갔다가 다시 넘으면 다시 호출)
+    using MemoryBudgetHandler = void(*)(MemoryTag tag, int64_t current, int64_t budget);
+
+    // 태그별 할당 통계 (lock-free, 전역 new 훅 안에서도 호출 가능하도록 힙을 쓰지 않음)
+    class MemoryTracker
+    {
+    public:
+        static void RecordAlloc(MemoryTag tag, size_t size);
+        static void RecordFree(MemoryTag tag, size_t size);
+
+        // 아레나가 Reset 시점에 이번 프레임의 최대 사용량(중간에 되감은 양 포함)을 보고
+        static void RecordArenaUsage(MemoryTag tag, size_t used);
+
+        // 0 이면 예산 없음
+        static void SetBudget(MemoryTag tag, int64_t bytes);
+        static void SetBudgetHandler(MemoryBudgetHandler handler) { s_BudgetHandler.store(handler, std::memory_order_release); }
+
+        static MemoryTagStats GetStats(MemoryTag tag);
+        static MemorySnapshot TakeSnapshot();
+
+        // 현재 스레드의 태그 (ScopedMemoryTag 로 변경)
+        static MemoryTag GetCurrentTag() { return s_CurrentTag; }
+
+    private:
+        friend class ScopedMemoryTag;
+
+        static void defaultBudgetHandler(MemoryTag tag, int64_t current, int64_t budget);
+
+        static inline std::array<internal::MemoryTagCounters, MemoryTagCount> s_Counters;
+        static inline std::atomic<MemoryBudgetHandler>                       s_BudgetHandler{ &MemoryTracker::defaultBudgetHandler };
+        static inline thread_local MemoryTag                                 s_CurrentTag = MemoryTag::General;
+    };
+
+    // 스코프 동안 현재 스레드의 할당을 tag 로 분류
+    class ScopedMemoryTag
+    {
+    public:
+        explicit ScopedMemoryTag(MemoryTag tag) : _previous(MemoryTracker::s_CurrentTag) { MemoryTracker::s_CurrentTag = tag; }
+        ~ScopedMemoryTag() { MemoryTracker::s_CurrentTag = _previous; }
+
+        ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+        ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+
+    private:
+        MemoryTag _previous;
+    };
+
+#pragma region IMPLEMENTS
+    inline void MemoryTracker::RecordAlloc(MemoryTag tag, size_t size)
+    {
+        internal::MemoryTagCounters& c = s_Counters[static_cast<size_t>(tag)];
+        const int64_t current = c.current.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) + static_cast<int64_t>(size);
+        c.allocCount.fetch_add(1, std::memory_order_relaxed);
+
+        int64_t peak = c.peak.load(std::memory_order_relaxed);
+        while (current > peak && !c.peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {}
+
+        const int64_t budget = c.budget.load(std::memory_order_relaxed);
+        if (budget > 0 && current > budget && !c.overBudget.exchange(true, std::memory_order_relaxed))
+        {
+            // 핸들러 안에서 다시 할당해도 재진입하지 않도록 플래그를 먼저 세운다
+            if (MemoryBudgetHandler handler = s_BudgetHandler.load(std::memory_order_acquire))
+                handler(tag, current, budget);
+        }
+    }
+
+    inline void MemoryTracker::RecordFree(MemoryTag tag, size_t size)
+    {
+        internal::MemoryTagCounters& c = s_Counters[static_cast<size_t>(tag)];
+        const int64_t current = c.current.fetch_sub(static_cast<int64_t>(size), std::memory_order_relaxed) - static_cast<int64_t>(size);
+        c.freeCount.fetch_add(1, std::memory_order_relaxed);
+
+        if (current <= c.budget.load(std::memory_order_relaxed))
+            c.overBudget.store(false, std::memory_order_relaxed);
+    }
+
+    inline void MemoryTracker::RecordArenaUsage(MemoryTag tag, size_t used)
+    {
+        internal::MemoryTagCounters& c = s_Counters[static_cast<size_t>(tag)];
+        int64_t highWater = c.arenaHighWater.load(std::memory_order_relaxed);
+        while (static_cast<int64_t>(used) > highWater
+            && !c.arenaHighWater.compare_exchange_weak(highWater, static_cast<int64_t>(used), std::memory_order_relaxed)) {}
+    }
+
+    inline void MemoryTracker::SetBudget(MemoryTag tag, int64_t bytes)
+    {
+        internal::MemoryTagCounters& c = s_Counters[static_cast<size_t>(tag)];
+        c.budget.store(bytes, std::memory_order_relaxed);
+        c.overBudget.store(false, std::memory_order_relaxed);
+    }
+
+    inline MemoryTagStats MemoryTracker::GetStats(MemoryTag tag)
+    {
+        const internal::MemoryTagCounters& c = s_Counters[static_cast<size_t>(tag)];
+        MemoryTagStats stats;
+        stats.current = c.current.load(std::memory_order_relaxed);
+        stats.peak = c.peak.load(std::memory_order_relaxed);
+        stats.allocCount = c.allocCount.load(std::memory_order_relaxed);
+        stats.freeCount = c.freeCount.load(std::memory_order_relaxed);
+        stats.arenaHighWater = c.arenaHighWater.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    inline MemorySnapshot MemoryTracker::TakeSnapshot()
+    {
+        MemorySnapshot snapshot;
+        for (size_t i = 0; i < MemoryTagCount; ++i)
+            snapshot.tags[i] = GetStats(static_cast<MemoryTag>(i));
+        return snapshot;
+    }
+
+    inline void MemoryTracker::defaultBudgetHandler(MemoryTag tag, int64_t current, int64_t budget)
+    {
+        // 할당 경로 안에서 불리므로 힙을 쓰지 않는 출력만 사용
+        std::fprintf(stderr, "[memory] %.*s budget exceeded: %lld / %lld bytes\n",
+                     static_cast<int>(GetMemoryTagName(tag).size()), GetMemoryTagName(tag).data(),
+                     static_cast<long long>(current), static_cast<long long>(budget));
+    }
+
+    inline MemorySnapshot MemorySnapshot::Diff(const MemorySnapshot& before, const MemorySnapshot& after)
+    {
+        MemorySnapshot diff;
+        for (size_t i = 0; i < MemoryTagCount; ++i)
+        {
+            diff.tags[i].current = after.tags[i].current - before.tags[i].current;
+            diff.tags[i].peak = after.tags[i].peak - before.tags[i].peak;
+            diff.tags[i].allocCount = after.tags[i].allocCount - before.tags[i].allocCount;
+            diff.tags[i].freeCount = after.tags[i].freeCount - before.tags[i].freeCount;
+            diff.tags[i].arenaHighWater = after.tags[i].arenaHighWater - before.tags[i].arenaHighWater;
+        }
+        return diff;
+    }
+
+    inline std::string MemorySnapshot::ToString() const
+    {
+        std::string out = "tag          current        peak      allocs       frees  arena-hw\n";
+        char line[160];
+        for (size_t i = 0; i < MemoryTagCount; ++i)
+        {
+            const MemoryTagStats& t = tags[i];
+            const std::string_view name = GetMemoryTagName(static_cast<MemoryTag>(i));
+            std::snprintf(line, sizeof(line), "%-10.*s %10lld %11lld %11lld %11lld %9lld\n",
+                          static_cast<int>(name.size()), name.data(),
+                          static_cast<long long>(t.current), static_cast<long long>(t.peak),
+                          static_cast<long long>(t.allocCount), static_cast<long long>(t.freeCount),
+                          static_cast<long long>(t.arenaHighWater));
+            out += line;
+        }
+        return out;
+    }
+#pragma endregion
+}
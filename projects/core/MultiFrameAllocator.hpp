@@ -0,0 +1,148 @@
+﻿#pragma once
+#include <array>
+#include <limits>
+#include <utility>
+#include <cassert>
+#include <cstdint>
+
+#include "FrameAllocator.hpp"
+
+namespace core
+{
+    // N 개의 FrameAllocator 를 프레임 번호(펜스 값)에 맞춰 돌려 쓰는 할당기
+    // GPU 나 다음 파이프라인 단계가 읽는 데이터도 해당 프레임이 retire 될 때까지 살아 있다
+    //
+    //  frame 0 -> 슬롯 0, frame 1 -> 슬롯 1, ... frame N -> 슬롯 0 (frame 0 이 retire 된 뒤에만)
+    //
+    // 사용 예:
+    //  fence.WaitFor(frame - N);           // N 프레임 전 GPU 작업 완료 대기
+    //  allocator.Retire(fence.GetCompletedValue());
+    //  allocator.BeginFrame(frame);
+    //  auto* drawList = allocator.Create<DrawList>();
+    template<size_t N>
+    class MultiFrameAllocator : public std::pmr::memory_resource
+    {
+        static_assert(N > 0, "MultiFrameAllocator: 최소 한 개의 아레나가 필요함");
+
+    public:
+        static constexpr uint64_t NoFrame = std::numeric_limits<uint64_t>::max();
+
+        explicit MultiFrameAllocator(size_t arenaSize, FrameAllocatorGrowth growth = FrameAllocatorGrowth::Fixed);
+
+        MultiFrameAllocator(const MultiFrameAllocator&) = delete;
+        MultiFrameAllocator& operator=(const MultiFrameAllocator&) = delete;
+
+        // completedFrame 이하 프레임의 아레나를 되감는다 (소멸자 실행 포함)
+        void Retire(uint64_t completedFrame);
+
+        // frameIndex 가 쓸 슬롯이 비어 있는지 (이전 사용 프레임이 retire 되었는지)
+        bool CanBeginFrame(uint64_t frameIndex) const;
+
+        // frameIndex 프레임의 할당을 시작한다. 슬롯이 아직 in-flight 이면 assert
+        FrameAllocator& BeginFrame(uint64_t frameIndex);
+
+        // Retire + BeginFrame
+        FrameAllocator& BeginFrame(uint64_t frameIndex, uint64_t completedFrame);
+
+        void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        template<typename T, typename... Args>
+        T* Create(Args&&... args);
+
+        FrameAllocator& GetCurrent() { return _arenas[_current]; }
+        uint64_t GetCurrentFrame() const { return _frames[_current]; }
+
+        // 아직 retire 되지 않은 프레임 수
+        size_t GetFramesInFlight() const;
+
+        static constexpr size_t GetArenaCount() { return N; }
+
+    protected:
+        // std::pmr::memory_resource: 해제는 no-op (Reset/RollbackTo 에서 한 번에 반환)
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override { return Allocate(bytes, alignment); }
+        void  do_deallocate(void*, std::size_t, std::size_t) override {}
+        bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    private:
+        template<size_t... I>
+        static std::array<FrameAllocator, N> makeArenas(size_t arenaSize, FrameAllocatorGrowth growth, std::index_sequence<I...>)
+        {
+            return { { ((void)I, FrameAllocator(arenaSize, growth))... } };
+        }
+
+        std::array<FrameAllocator, N> _arenas;
+        std::array<uint64_t, N>       _frames;    // 슬롯을 마지막으로 쓴 프레임 (NoFrame = 비어 있음)
+        size_t                        _current = 0;
+    };
+
+#pragma region IMPLEMENTS
+    template<size_t N>
+    MultiFrameAllocator<N>::MultiFrameAllocator(size_t arenaSize, FrameAllocatorGrowth growth)
+        : _arenas(makeArenas(arenaSize, growth, std::make_index_sequence<N>{}))
+    {
+        _frames.fill(NoFrame);
+    }
+
+    template<size_t N>
+    void MultiFrameAllocator<N>::Retire(uint64_t completedFrame)
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            if (_frames[i] != NoFrame && _frames[i] <= completedFrame)
+            {
+                _arenas[i].Reset();
+                _frames[i] = NoFrame;
+            }
+        }
+    }
+
+    template<size_t N>
+    bool MultiFrameAllocator<N>::CanBeginFrame(uint64_t frameIndex) const
+    {
+        const uint64_t owner = _frames[frameIndex % N];
+        return owner == NoFrame || owner == frameIndex;
+    }
+
+    template<size_t N>
+    FrameAllocator& MultiFrameAllocator<N>::BeginFrame(uint64_t frameIndex)
+    {
+        assert(frameIndex != NoFrame);
+        assert(CanBeginFrame(frameIndex) && "MultiFrameAllocator: 슬롯의 이전 프레임이 아직 retire 되지 않음");
+
+        _current = static_cast<size_t>(frameIndex % N);
+        _frames[_current] = frameIndex;
+        return _arenas[_current];
+    }
+
+    template<size_t N>
+    FrameAllocator& MultiFrameAllocator<N>::BeginFrame(uint64_t frameIndex, uint64_t completedFrame)
+    {
+        Retire(completedFrame);
+        return BeginFrame(frameIndex);
+    }
+
+    template<size_t N>
+    void* MultiFrameAllocator<N>::Allocate(std::size_t size, std::size_t alignment)
+    {
+        assert(_frames[_current] != NoFrame && "MultiFrameAllocator: BeginFrame 전에 할당");
+        return _arenas[_current].Allocate(size, alignment);
+    }
+
+    template<size_t N>
+    template<typename T, typename... Args>
+    T* MultiFrameAllocator<N>::Create(Args&&... args)
+    {
+        assert(_frames[_current] != NoFrame && "MultiFrameAllocator: BeginFrame 전에 할당");
+        return _arenas[_current].template Create<T>(std::forward<Args>(args)...);
+    }
+
+    template<size_t N>
+    size_t MultiFrameAllocator<N>::GetFramesInFlight() const
+    {
+        size_t count = 0;
+        for (uint64_t frame : _frames)
+            count += frame != NoFrame;
+        return count;
+    }
+#pragma endregion
+}
@@ -0,0 +1,249 @@
+﻿#pragma once
+#include <new>
+#include <bitset>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <limits>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+namespace core
+{
+    // 세대(generation)가 붙은 풀 핸들
+    // 슬롯이 재사용되면 세대가 올라가므로 오래된 핸들로 접근하면 Get 이 nullptr 를 돌려준다
+    //  - uint32_t : 인덱스 20비트(약 100만 개) + 세대 12비트
+    //  - uint64_t : 인덱스 32비트 + 세대 32비트
+    // 값 0 은 항상 무효 핸들 (세대는 1 부터 시작)
+    template<typename T, typename Storage = uint32_t>
+    class PoolHandle
+    {
+        static_assert(std::is_same_v<Storage, uint32_t> || std::is_same_v<Storage, uint64_t>, "PoolHandle: uint32_t 또는 uint64_t");
+
+    public:
+        static constexpr uint32_t IndexBits = sizeof(Storage) == 4 ? 20 : 32;
+        static constexpr uint32_t GenerationBits = sizeof(Storage) * 8 - IndexBits;
+        static constexpr Storage  MaxIndex = (Storage{ 1 } << IndexBits) - 1;
+        static constexpr Storage  MaxGeneration = (Storage{ 1 } << GenerationBits) - 1;
+
+        constexpr PoolHandle() = default;
+        constexpr PoolHandle(Storage index, Storage generation)
+            : _value((generation << IndexBits) | index) {}
+
+        constexpr Storage GetIndex() const { return _value & MaxIndex; }
+        constexpr Storage GetGeneration() const { return _value >> IndexBits; }
+        constexpr Storage GetValue() const { return _value; }
+        constexpr bool    IsValid() const { return _value != 0; }
+
+        static constexpr PoolHandle FromValue(Storage value) { PoolHandle h; h._value = value; return h; }
+
+        constexpr bool operator==(const PoolHandle&) const = default;
+
+    private:
+        Storage _value = 0;
+    };
+
+    template<typename T> using Handle32 = PoolHandle<T, uint32_t>;
+    template<typename T> using Handle64 = PoolHandle<T, uint64_t>;
+
+    // 고정 크기 객체 풀 (단일 스레드)
+    // ChunkSize 개씩 연속된 청크에 저장하고, 해제된 슬롯은 free list 로 재사용한다 (LIFO, 캐시에 남아 있을 확률이 높음)
+    // 청크는 이동하지 않으므로 Get 으로 얻은 포인터는 Destroy 전까지 유효하다
+    template<typename T, typename HandleStorage = uint32_t, size_t ChunkSize = 256>
+    class ObjectPool
+    {
+        static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "ObjectPool: ChunkSize 는 2의 거듭제곱");
+
+    public:
+        using Handle = PoolHandle<T, HandleStorage>;
+
+        ObjectPool() = default;
+        ~ObjectPool();
+
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        template<typename... Args>
+        Handle Create(Args&&... args);
+
+        // 오래된/무효 핸들이면 아무것도 하지 않고 false
+        bool Destroy(Handle handle);
+
+        // 오래된/무효 핸들이면 nullptr
+        T*       Get(Handle handle);
+        const T* Get(Handle handle) const;
+
+        bool IsAlive(Handle handle) const { return Get(handle) != nullptr; }
+
+        // 살아 있는 객체를 청크 순서대로 순회. fn(T&) 또는 fn(Handle, T&)
+        template<typename Fn>
+        void ForEach(Fn&& fn);
+
+        void Clear();
+
+        size_t GetSize() const { return _size; }
+        size_t GetCapacity() const { return _chunks.size() * ChunkSize; }
+
+    private:
+        static constexpr uint32_t NoSlot = std::numeric_limits<uint32_t>::max();
+
+        struct Chunk
+        {
+            alignas(T) std::byte  storage[ChunkSize * sizeof(T)];
+            HandleStorage         generations[ChunkSize];
+            uint32_t              nextFree[ChunkSize];
+            std::bitset<ChunkSize> alive;
+
+            T* At(size_t slot) { return std::launder(reinterpret_cast<T*>(storage + slot * sizeof(T))); }
+        };
+
+        Chunk* findAlive(Handle handle) const;
+        void   addChunk();
+
+        std::vector<std::unique_ptr<Chunk>> _chunks;
+        uint32_t                            _freeHead = NoSlot;
+        size_t                              _size = 0;
+    };
+
+#pragma region IMPLEMENTS
+    template<typename T, typename HandleStorage, size_t ChunkSize>
+    ObjectPool<T, HandleStorage, ChunkSize>::~ObjectPool()
+    {
+        Clear();
+    }
+
+    template<typename T, typename HandleStorage, size_t ChunkSize>
+    template<typename... Args>
+    typename ObjectPool<T, HandleStorage, ChunkSize>::Handle ObjectPool<T, HandleStorage, ChunkSize>::Create(Args&&... args)
+    {
+        if (_freeHead == NoSlot)
+            addChunk();
+
+        const uint32_t index = _freeHead;
+        Chunk& chunk = *_chunks[index / ChunkSize];
+        const size_t slot = index % ChunkSize;
+
+        // 생성자가 예외를 던지면 슬롯은 free list 에 그대로 남는다
+        new (chunk.storage + slot * sizeof(T)) T(std::forward<Args>(args)...);
+
+        _freeHead = chunk.nextFree[slot];
+        chunk.alive.set(slot);
+        ++_size;
+        return Handle(index, chunk.generations[slot]);
+    }
+
+    template<typename T, typename HandleStorage, size_t ChunkSize>
+    bool ObjectPool<T, HandleStorage, ChunkSize>::Destroy(Handle handle)
+    {
+        Chunk* chunk = findAlive(handle);
+        if (!chunk)
+            return false;
+
+        const uint32_t index = static_cast<uint32_t>(handle.GetIndex());
+        const size_t slot = index % ChunkSize;
+
+        chunk->At(slot)->~T();
+        chunk->alive.reset(slot);
+        --_size;
+
+        // 세대가 한 바퀴 돌면 슬롯을 영구히 은퇴시켜 오래된 핸들이 다시 맞는 일을 막는다
+        if (chunk->generations[slot] == Handle::MaxGeneration)
+            return true;
+
+        ++chunk->generations[slot];
+        chunk->nextFree[slot] = _freeHead;
+        _freeHead = index;
+        return true;
+    }
+
+    template<typename T, typename HandleStorage, size_t ChunkSize>
+    T* ObjectPool<T, HandleStorage, ChunkSize>::Get(Handle handle)
+    {
+        Chunk* chunk = findAlive(handle);
+        return chunk ? chunk->At(handle.GetIndex() % ChunkSize) : nullptr;
+    }
+
+    template<typename T, typename HandleStorage, size_t ChunkSize>
+    const T* ObjectPool<T, HandleStorage, ChunkSize>::Get(Handle handle) const
+    {
+        Chunk* chunk = findAlive(handle);
+        return chunk ? chunk->At(handle.GetIndex() % ChunkSize) : nullptr;
+    }
+
+    template<typename T, typename HandleStorage, size_t ChunkSize>
+    template<typename Fn>
+    void ObjectPool<T, HandleStorage, ChunkSize>::ForEach(Fn&& fn)
+    {
+        for (size_t c = 0; c < _chunks.size(); ++c)
+        {
+            Chunk& chunk = *_chunks[c];
+            if (chunk.alive.none())
+                continue;
+
+            for (size_t slot = 0; slot < ChunkSize; ++slot)
+            {
+                if (!chunk.alive.test(slot))
+                    continue;
+
+                if constexpr (std::is_invocable_v<Fn&, Handle, T&>)
+                    fn(Handle(static_cast<HandleStorage>(c * ChunkSize + slot), chunk.generations[slot]), *chunk.At(slot));
+                else
+                    fn(*chunk.At(slot));
+            }
+        }
+    }
+
+    template<typename T, typename HandleStorage, size_t ChunkSize>
+    void ObjectPool<T, HandleStorage, ChunkSize>::Clear()
+    {
+        // 남은 핸들이 모두 무효가 되도록 Destroy 경로를 그대로 탄다
+        for (size_t c = 0; c < _chunks.size(); ++c)
+        {
+            Chunk& chunk = *_chunks[c];
+            for (size_t slot = 0; slot < ChunkSize && chunk.alive.any(); ++slot)
+            {
+                if (chunk.alive.test(slot))
+                    Destroy(Handle(static_cast<HandleStorage>(c * ChunkSize + slot), chunk.generations[slot]));
+            }
+        }
+    }
+
+    template<typename T, typename HandleStorage, size_t ChunkSize>
+    typename ObjectPool<T, HandleStorage, ChunkSize>::Chunk* ObjectPool<T, HandleStorage, ChunkSize>::findAlive(Handle handle) const
+    {
+        const size_t index = static_cast<size_t>(handle.GetIndex());
+        const size_t c = index / ChunkSize;
+        if (!handle.IsValid() || c >= _chunks.size())
+            return nullptr;
+
+        Chunk* chunk = _chunks[c].get();
+        const size_t slot = index % ChunkSize;
+        if (!chunk->alive.test(slot) || chunk->generations[slot] != handle.GetGeneration())
+            return nullptr;
+        return chunk;
+    }
+
+    template<typename T, typename HandleStorage, size_t ChunkSize>
+    void ObjectPool<T, HandleStorage, ChunkSize>::addChunk()
+    {
+        const size_t base = _chunks.size() * ChunkSize;
+        const size_t maxIndex = (std::min)(static_cast<size_t>(Handle::MaxIndex), static_cast<size_t>(NoSlot) - 1);
+        if (base + ChunkSize - 1 > maxIndex)
+            throw std::bad_alloc();
+
+        // storage 는 초기화하지 않는다 (make_unique 는 값 초기화)
+        std::unique_ptr<Chunk> chunk(new Chunk);
+        // 앞쪽 슬롯부터 쓰이도록 역순으로 free list 에 연결
+        for (size_t slot = ChunkSize; slot-- > 0;)
+        {
+            chunk->generations[slot] = 1;
+            chunk->nextFree[slot] = _freeHead;
+            _freeHead = static_cast<uint32_t>(base + slot);
+        }
+        _chunks.push_back(std::move(chunk));
+    }
+#pragma endregion
+}
@@ -0,0 +1,248 @@
+﻿#pragma once
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <utility>
+#include <exception>
+#include <algorithm>
+#include <type_traits>
+
+#include "ThreadPool.hpp"
+
+namespace core
+{
+    // [begin, end) 인덱스 범위
+    struct IndexRange
+    {
+        size_t begin = 0;
+        size_t end = 0;
+
+        size_t Size() const { return end > begin ? end - begin : 0; }
+        bool Empty() const { return end <= begin; }
+    };
+
+    namespace internal
+    {
+        // grainSize 0 이면 워커 수 기준으로 적당한 크기를 고른다
+        inline size_t resolve_grain(const ThreadPool& pool, IndexRange range, size_t grainSize)
+        {
+            if (grainSize > 0) return grainSize;
+            const size_t target = (pool.GetWorkerCount() + 1) * 16;
+            return (std::max)(size_t{ 1 }, range.Size() / target);
+        }
+
+        // 한 번의 ParallelFor / ParallelReduce 호출이 공유하는 제어 블록
+        // 분할된 작업들이 참조하므로 pool.Wait(counter) 가 끝나기 전에는 파괴되면 안 된다
+        struct SplitControl
+        {
+            ThreadPool&          pool;
+            size_t               grain;
+            JobCounter           counter;
+
+            // 가장 먼저 던져진 예외. 모든 작업이 끝난 뒤 호출한 스레드에서 다시 던진다
+            std::atomic<bool>    failed{ false };
+            std::exception_ptr   exception;
+
+            // 풀 밖의 스레드가 전역 큐에 넣었지만 아직 아무도 시작하지 않은 분할 작업 수
+            std::atomic<size_t>  externalPending{ 0 };
+
+            SplitControl(ThreadPool& p, size_t g) : pool(p), grain(g) {}
+
+            void CaptureException() noexcept
+            {
+                if (!failed.exchange(true, std::memory_order_acq_rel))
+                    exception = std::current_exception();
+            }
+
+            // 워커는 자기 큐가 비었는지로 판단한다. 풀 밖의 스레드에게는 자기 큐가 없고,
+            // 전역 큐 크기에는 다른 제출자의 작업도 섞여 있으므로 이 호출이 넣은 작업이 모두 시작됐는지로 판단한다
+            bool ShouldSplit(bool external) const
+            {
+                if (external)
+                    return externalPending.load(std::memory_order_acquire) == 0;
+                return pool.GetLocalQueueSize() == 0;
+            }
+        };
+
+        // Lazy binary splitting (Tzannes et al., PPoPP 2010)
+        // grain 단위로 처리하다가 자기 큐가 비어 있으면(= 다른 스레드가 일을 가져갔거나 놀고 있음)
+        // 남은 범위의 오른쪽 절반을 떼어 작업으로 등록한다. 부하가 고르면 분할이 거의 일어나지 않고,
+        // 불균형하면 필요한 만큼만 쪼개지므로 grain 이 부하에 맞춰 자동으로 조절되는 효과가 있다
+        //
+        // 예외는 밖으로 내보내지 않고 control 에 기록한다. 호출한 스레드에서 던져진 예외가 그대로 빠져나가면
+        // 스택의 control / ctx 가 Wait 전에 파괴되어, 아직 실행 중인 작업이 해제된 메모리를 쓰게 된다
+        //
+        // Context 요구사항
+        //   using State = ...;                          작업(task) 단위 누적 상태
+        //   State MakeState() const;
+        //   void  Run(IndexRange chunk, State&) const;
+        //   void  Finish(size_t taskBegin, State&&);    작업이 처리한 연속 구간 [taskBegin, ...) 의 결과
+        template<typename Context>
+        void lazy_split_run(SplitControl& control, Context& ctx, IndexRange range) noexcept
+        {
+            try
+            {
+                ThreadPool& pool = control.pool;
+                const bool external = pool.GetCurrentWorkerIndex() < 0;
+
+                typename Context::State state = ctx.MakeState();
+                const size_t taskBegin = range.begin;
+
+                while (!range.Empty())
+                {
+                    // 다른 작업이 실패했으면 남은 구간은 버린다
+                    if (control.failed.load(std::memory_order_relaxed))
+                        return;
+
+                    if (range.Size() > control.grain && control.ShouldSplit(external))
+                    {
+                        const size_t mid = range.begin + range.Size() / 2;
+                        const IndexRange right{ mid, range.end };
+                        if (external)
+                            control.externalPending.fetch_add(1, std::memory_order_relaxed);
+                        pool.Enqueue([&control, &ctx, right, external]
+                        {
+                            if (external)
+                                control.externalPending.fetch_sub(1, std::memory_order_release);
+                            lazy_split_run(control, ctx, right);
+                        }, &control.counter);
+                        range.end = mid;
+                        continue;
+                    }
+
+                    const size_t chunkEnd = (std::min)(range.begin + control.grain, range.end);
+                    ctx.Run(IndexRange{ range.begin, chunkEnd }, state);
+                    range.begin = chunkEnd;
+                }
+
+                ctx.Finish(taskBegin, std::move(state));
+            }
+            catch (...)
+            {
+                control.CaptureException();
+            }
+        }
+
+        // 호출한 스레드가 첫 구간을 맡고, 분할된 작업이 모두 끝날 때까지 기다린 뒤 예외를 전파한다
+        template<typename Context>
+        void run_split_and_wait(SplitControl& control, Context& ctx, IndexRange range)
+        {
+            lazy_split_run(control, ctx, range);
+            control.pool.Wait(control.counter);
+
+            if (control.exception)
+                std::rethrow_exception(control.exception);
+        }
+
+        template<typename Fn>
+        struct ForContext
+        {
+            struct State {};
+
+            Fn& fn;
+
+            State MakeState() const { return {}; }
+
+            void Run(IndexRange chunk, State&) const
+            {
+                if constexpr (std::is_invocable_v<Fn&, size_t>)
+                {
+                    for (size_t i = chunk.begin; i < chunk.end; ++i)
+                        fn(i);
+                }
+                else
+                {
+                    fn(chunk);
+                }
+            }
+
+            void Finish(size_t, State&&) {}
+        };
+
+        template<typename T, typename Fn, typename ReduceFn>
+        struct ReduceContext
+        {
+            using State = T;
+
+            ReduceContext(const T& identity, Fn& fn, ReduceFn& reduce)
+                : identity(identity), fn(fn), reduce(reduce) {}
+
+            const T&   identity;
+            Fn&        fn;
+            ReduceFn&  reduce;
+
+            // 작업별 부분 결과 (시작 인덱스 순으로 정렬해 합치므로 교환법칙은 필요 없다)
+            std::mutex                          mutex;
+            std::vector<std::pair<size_t, T>>   partials;
+
+            State MakeState() const { return identity; }
+
+            void Run(IndexRange chunk, State& acc) const
+            {
+                if constexpr (std::is_invocable_v<Fn&, size_t>)
+                {
+                    for (size_t i = chunk.begin; i < chunk.end; ++i)
+                        acc = reduce(std::move(acc), fn(i));
+                }
+                else
+                {
+                    acc = fn(chunk, std::move(acc));
+                }
+            }
+
+            void Finish(size_t taskBegin, State&& acc)
+            {
+                std::lock_guard<std::mutex> lk(mutex);
+                partials.emplace_back(taskBegin, std::move(acc));
+            }
+        };
+    }
+
+    // 데이터 병렬 반복
+    // fn 은 fn(size_t index) (원소 단위) 또는 fn(IndexRange chunk) (구간 단위) 형태
+    // grainSize: 한 번에 처리할 최소 원소 수 (0 이면 자동)
+    // 호출한 스레드도 작업에 참여하며, 작업 안에서 중첩 호출해도 안전하다
+    // fn 이 던진 예외는 나머지 구간을 건너뛰고 모든 작업이 끝난 뒤 호출한 스레드에서 다시 던진다 (여러 개면 첫 번째만)
+    template<typename Fn>
+    void ParallelFor(ThreadPool& pool, IndexRange range, size_t grainSize, Fn&& fn)
+    {
+        if (range.Empty())
+            return;
+
+        const size_t grain = internal::resolve_grain(pool, range, grainSize);
+        internal::ForContext<std::remove_reference_t<Fn>> ctx{ fn };
+
+        internal::SplitControl control(pool, grain);
+        internal::run_split_and_wait(control, ctx, range);
+    }
+
+    template<typename Fn>
+    void ParallelFor(ThreadPool& pool, size_t begin, size_t end, size_t grainSize, Fn&& fn)
+    {
+        ParallelFor(pool, IndexRange{ begin, end }, grainSize, std::forward<Fn>(fn));
+    }
+
+    // 데이터 병렬 리듀스
+    // fn 은 T fn(size_t index) (원소 단위, reduce 로 누적) 또는 T fn(IndexRange chunk, T acc) (구간 단위)
+    // reduce 는 결합법칙을 만족해야 한다 (교환법칙은 필요 없음)
+    template<typename T, typename Fn, typename ReduceFn>
+    T ParallelReduce(ThreadPool& pool, IndexRange range, size_t grainSize, T identity, Fn&& fn, ReduceFn&& reduce)
+    {
+        if (range.Empty())
+            return identity;
+
+        const size_t grain = internal::resolve_grain(pool, range, grainSize);
+        internal::ReduceContext<T, std::remove_reference_t<Fn>, std::remove_reference_t<ReduceFn>> ctx(identity, fn, reduce);
+
+        internal::SplitControl control(pool, grain);
+        internal::run_split_and_wait(control, ctx, range);
+
+        std::sort(ctx.partials.begin(), ctx.partials.end(),
+            [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        T result = std::move(identity);
+        for (auto& [begin, partial] : ctx.partials)
+            result = reduce(std::move(result), std::move(partial));
+        return result;
+    }
+}
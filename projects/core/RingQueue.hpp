@@ -0,0 +1,87 @@
+﻿#pragma once
+#include <memory>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+namespace core
+{
+	namespace internal
+	{
+        // 단일 스레드용 FIFO 링 버퍼 (동기화는 호출자 책임)
+        // 가득 차면 두 배로 늘리고 줄이지 않으므로, std::deque 와 달리 정상 상태에서 노드 할당이 없다
+        template<typename T>
+        class RingQueue
+        {
+        public:
+            explicit RingQueue(size_t capacity = 256);
+
+            void PushBack(T item);
+            T PopFront();
+
+            T& Front() { assert(!Empty()); return _buffer[_head]; }
+
+            bool Empty() const { return _size == 0; }
+            size_t Size() const { return _size; }
+
+            // 앞에서부터 순회 (정리 용도)
+            template<typename Fn>
+            void ForEach(Fn&& fn);
+
+        private:
+            void grow();
+
+            std::unique_ptr<T[]> _buffer;
+            size_t _capacity;
+            size_t _head = 0;
+            size_t _size = 0;
+        };
+
+        template <typename T>
+        RingQueue<T>::RingQueue(size_t capacity) : _buffer(std::make_unique<T[]>(capacity)), _capacity(capacity)
+        {
+            assert(capacity > 0);
+        }
+
+        template <typename T>
+        void RingQueue<T>::PushBack(T item)
+        {
+            if (_size == _capacity)
+                grow();
+
+            _buffer[(_head + _size) % _capacity] = std::move(item);
+            ++_size;
+        }
+
+        template <typename T>
+        T RingQueue<T>::PopFront()
+        {
+            assert(!Empty());
+            T item = std::move(_buffer[_head]);
+            _head = (_head + 1) % _capacity;
+            --_size;
+            return item;
+        }
+
+        template <typename T>
+        template <typename Fn>
+        void RingQueue<T>::ForEach(Fn&& fn)
+        {
+            for (size_t i = 0; i < _size; ++i)
+                fn(_buffer[(_head + i) % _capacity]);
+        }
+
+        template <typename T>
+        void RingQueue<T>::grow()
+        {
+            const size_t newCapacity = _capacity * 2;
+            auto bigger = std::make_unique<T[]>(newCapacity);
+            for (size_t i = 0; i < _size; ++i)
+                bigger[i] = std::move(_buffer[(_head + i) % _capacity]);
+
+            _buffer = std::move(bigger);
+            _capacity = newCapacity;
+            _head = 0;
+        }
+	}
+}
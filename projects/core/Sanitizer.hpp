@@ -0,0 +1,25 @@
+﻿#pragma once
+#include <cstddef>
+
+// AddressSanitizer 수동 poisoning
+// /fsanitize=address (MSVC), -fsanitize=address (gcc/clang) 빌드에서만 동작하고 그 외에는 아무 코드도 남지 않는다
+#if defined(__SANITIZE_ADDRESS__)
+#define CORE_ASAN_ENABLED 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define CORE_ASAN_ENABLED 1
+#endif
+#endif
+
+#ifndef CORE_ASAN_ENABLED
+#define CORE_ASAN_ENABLED 0
+#endif
+
+#if CORE_ASAN_ENABLED
+#include <sanitizer/asan_interface.h>
+#define CORE_ASAN_POISON(addr, size)   ASAN_POISON_MEMORY_REGION((addr), (size))
+#define CORE_ASAN_UNPOISON(addr, size) ASAN_UNPOISON_MEMORY_REGION((addr), (size))
+#else
+#define CORE_ASAN_POISON(addr, size)   ((void)(addr), (void)(size))
+#define CORE_ASAN_UNPOISON(addr, size) ((void)(addr), (void)(size))
+#endif
@@ -0,0 +1,290 @@
+﻿#pragma once
+#include <memory>
+#include <cassert>
+#include <utility>
+#include <optional>
+#include <exception>
+#include <coroutine>
+#include <type_traits>
+
+#include "Future.hpp"
+#include "ThreadPool.hpp"
+
+namespace core
+{
+    template<typename T = void>
+    class Task;
+
+    namespace internal
+    {
+        // Task 프라미스 공통부: 예외 보관 + 완료 시 기다리던 코루틴으로 대칭 전환(symmetric transfer)
+        class TaskPromiseBase
+        {
+        public:
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+
+                template<typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) noexcept
+                {
+                    std::coroutine_handle<> continuation = h.promise()._continuation;
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            // 지연 시작: co_await 하거나 Spawn 할 때 실행된다
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            FinalAwaiter final_suspend() const noexcept { return {}; }
+
+            void unhandled_exception() { _error = std::current_exception(); }
+
+            void SetContinuation(std::coroutine_handle<> continuation) { _continuation = continuation; }
+
+            void RethrowIfFailed() const
+            {
+                if (_error)
+                    std::rethrow_exception(_error);
+            }
+
+        private:
+            std::coroutine_handle<> _continuation;
+            std::exception_ptr      _error;
+        };
+
+        template<typename T>
+        class TaskPromise final : public TaskPromiseBase
+        {
+        public:
+            Task<T> get_return_object() noexcept;
+
+            template<typename U>
+            void return_value(U&& value) { _value.emplace(std::forward<U>(value)); }
+
+            T TakeValue()
+            {
+                RethrowIfFailed();
+                return std::move(*_value);
+            }
+
+        private:
+            std::optional<T> _value;
+        };
+
+        template<>
+        class TaskPromise<void> final : public TaskPromiseBase
+        {
+        public:
+            Task<void> get_return_object() noexcept;
+
+            void return_void() const noexcept {}
+
+            void TakeValue() const { RethrowIfFailed(); }
+        };
+
+        // 즉시 시작되고 끝나면 스스로 정리되는 코루틴 (Spawn 내부용)
+        struct DetachedCoroutine
+        {
+            struct promise_type
+            {
+                DetachedCoroutine get_return_object() const noexcept { return {}; }
+                std::suspend_never initial_suspend() const noexcept { return {}; }
+                std::suspend_never final_suspend() const noexcept { return {}; }
+                void return_void() const noexcept {}
+                void unhandled_exception() const noexcept { std::terminate(); }
+            };
+        };
+    }
+
+    // C++20 코루틴 작업 타입
+    // - 지연 시작: 다른 코루틴에서 co_await 하거나 Spawn / SyncWait 로 실행한다
+    // - co_await 한 Task 가 끝나면 기다리던 코루틴이 같은 스레드에서 바로 이어서 실행된다
+    // - 코루틴 안에서 던진 예외는 co_await 하는 쪽으로 전달된다
+    // - 실행 스레드 이동은 Schedule / ResumeOn / WaitFrames 를 co_await 해서 지정한다
+    template<typename T>
+    class Task
+	{
+    public:
+        using promise_type = internal::TaskPromise<T>;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        Task() = default;
+        explicit Task(Handle handle) : _handle(handle) {}
+
+        Task(Task&& other) noexcept : _handle(std::exchange(other._handle, {})) {}
+        Task& operator=(Task&& other) noexcept;
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        ~Task();
+
+        bool IsValid() const { return static_cast<bool>(_handle); }
+        bool IsDone() const { return _handle && _handle.done(); }
+
+        // co_await 지원
+        bool await_ready() const noexcept { return !_handle || _handle.done(); }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept;
+        T await_resume();
+
+    private:
+        Handle _handle;
+    };
+
+    // 풀 워커에서 이어서 실행
+    struct ScheduleAwaiter
+    {
+        ThreadPool&  pool;
+        JobPriority  priority;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> h) const { pool.Enqueue([h] { h.resume(); }, priority); }
+        void await_resume() const noexcept {}
+    };
+
+    // 친화 큐(메인/렌더 스레드 등)에서 이어서 실행. 해당 스레드의 Pump 지점에서 재개된다
+    struct ResumeOnAwaiter
+    {
+        ThreadPool&      pool;
+        AffinityQueueId  queue;
+
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> h) const { pool.EnqueueTo(queue, [h] { h.resume(); }); }
+        void await_resume() const noexcept {}
+    };
+
+    // frames 번의 AdvanceFrame 이후 풀 워커에서 이어서 실행
+    struct WaitFramesAwaiter
+    {
+        ThreadPool&  pool;
+        uint32_t     frames;
+        JobPriority  priority;
+
+        bool await_ready() const noexcept { return frames == 0; }
+        void await_suspend(std::coroutine_handle<> h) const { pool.EnqueueAfterFrames(frames, [h] { h.resume(); }, priority); }
+        void await_resume() const noexcept {}
+    };
+
+    // Future 완료 후 이어서 실행 (Future 의 후속 작업으로 풀에 등록된다)
+    // 실패해도 재개해야 하므로 Then 이 아닌 OnComplete 를 쓰고, 예외는 await_resume 의 Get 에서 코루틴 안으로 다시 던진다
+    template<typename T>
+    struct FutureAwaiter
+    {
+        Future<T> future;
+
+        bool await_ready() const noexcept { return future.IsReady(); }
+        void await_suspend(std::coroutine_handle<> h) const { future.OnComplete([h] { h.resume(); }); }
+        decltype(auto) await_resume() const { return future.Get(); }
+    };
+
+    inline ScheduleAwaiter Schedule(ThreadPool& pool, JobPriority priority = JobPriority::Normal)
+    {
+        return { pool, priority };
+    }
+
+    inline ResumeOnAwaiter ResumeOn(ThreadPool& pool, AffinityQueueId queue)
+    {
+        return { pool, queue };
+    }
+
+    inline WaitFramesAwaiter WaitFrames(ThreadPool& pool, uint32_t frames, JobPriority priority = JobPriority::Normal)
+    {
+        return { pool, frames, priority };
+    }
+
+    template<typename T>
+    FutureAwaiter<T> operator co_await(Future<T> future)
+    {
+        return { std::move(future) };
+    }
+
+    // Task 를 풀에서 시작하고 결과를 Future 로 받는다 (코루틴이 아닌 코드와의 경계)
+    template<typename T>
+    Future<T> Spawn(ThreadPool& pool, Task<T> task, JobPriority priority = JobPriority::Normal);
+
+    // Task 를 풀에서 실행하고 도우면서 완료를 기다린다
+    template<typename T>
+    T SyncWait(ThreadPool& pool, Task<T> task)
+    {
+        return Spawn(pool, std::move(task)).Get();
+    }
+
+#pragma region IMPLEMENTS
+    namespace internal
+    {
+        template <typename T>
+        Task<T> TaskPromise<T>::get_return_object() noexcept
+        {
+            return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+        }
+
+        inline Task<void> TaskPromise<void>::get_return_object() noexcept
+        {
+            return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+        }
+
+        template<typename T>
+        DetachedCoroutine spawn_coroutine(ThreadPool& pool, Task<T> task, std::shared_ptr<FutureState<T>> state, JobPriority priority)
+        {
+            co_await Schedule(pool, priority);
+            try
+            {
+                if constexpr (std::is_void_v<T>)
+                {
+                    co_await task;
+                    state->SetValue();
+                }
+                else
+                {
+                    state->SetValue(co_await task);
+                }
+            }
+            catch (...)
+            {
+                state->SetError(std::current_exception());
+            }
+        }
+    }
+
+    template <typename T>
+    Task<T>& Task<T>::operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (_handle) _handle.destroy();
+            _handle = std::exchange(other._handle, {});
+        }
+        return *this;
+    }
+
+    template <typename T>
+    Task<T>::~Task()
+    {
+        if (_handle) _handle.destroy();
+    }
+
+    template <typename T>
+    std::coroutine_handle<> Task<T>::await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+        _handle.promise().SetContinuation(awaiting);
+        return _handle;
+    }
+
+    template <typename T>
+    T Task<T>::await_resume()
+    {
+        assert(_handle && "Task: 빈 Task");
+        return _handle.promise().TakeValue();
+    }
+
+    template <typename T>
+    Future<T> Spawn(ThreadPool& pool, Task<T> task, JobPriority priority)
+    {
+        auto state = std::make_shared<internal::FutureState<T>>(&pool);
+        internal::spawn_coroutine<T>(pool, std::move(task), state, priority);
+        return Future<T>(state);
+    }
+#pragma endregion
+}
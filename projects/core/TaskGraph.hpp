@@ -0,0 +1,246 @@
+﻿#pragma once
+#include <span>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <exception>
+#include <functional>
+
+#include "ThreadPool.hpp"
+
+namespace core
+{
+    // 그래프 내 작업 식별자 (AddTask 가 반환)
+    struct TaskHandle
+    {
+        uint32_t index = UINT32_MAX;
+
+        bool IsValid() const { return index != UINT32_MAX; }
+    };
+
+    // 작업 의존성 그래프 (job DAG)
+    // - AddTask / AddEdge 로 그래프를 구성한 뒤 Submit 으로 한 번에 실행
+    // - 선행 작업이 모두 끝난 작업은 즉시 풀에 등록되므로 독립된 가지끼리는 겹쳐 실행된다
+    // - 실행 중에는 그래프를 수정하지 말 것. Wait 이후 Submit 으로 재실행 가능 (프레임마다 재사용)
+    class TaskGraph
+	{
+    public:
+        using TaskFunc = std::function<void()>;
+
+        TaskGraph() = default;
+        ~TaskGraph();
+
+        TaskGraph(const TaskGraph&) = delete;
+        TaskGraph& operator=(const TaskGraph&) = delete;
+
+        // 1) 그래프 구성
+        TaskHandle AddTask(TaskFunc fn);
+        void AddEdge(TaskHandle before, TaskHandle after);  // before 가 끝나야 after 시작
+
+        // 2) 실행: 선행 작업이 없는 작업부터 풀에 등록
+        void Submit(ThreadPool& pool);
+
+        // 3) 대기: 개별 작업 / 작업 집합 / 전체
+        //    ThreadPool::WaitUntil 기반이므로 대기 중인 스레드도 작업을 실행하며, 작업 안에서 호출해도 안전
+        //    작업 중 예외가 발생했다면 대기 후 첫 번째 예외를 다시 던진다
+        void Wait(TaskHandle task);
+        void Wait(std::span<const TaskHandle> tasks);
+        void WaitAll();
+
+        bool IsDone(TaskHandle task) const;
+
+        // 순환 의존성이 없으면 true (Submit 이 디버그 빌드에서 확인한다)
+        bool IsAcyclic() const;
+
+        // 작업과 간선을 모두 제거 (실행 중이 아닐 때만)
+        void Clear();
+
+        size_t GetTaskCount() const { return _nodes.size(); }
+
+    private:
+        struct Node
+        {
+            TaskFunc                 fn;
+            std::vector<uint32_t>    successors;
+            uint32_t                 predecessorCount = 0;
+            std::atomic<uint32_t>    remaining { 0 };
+            std::atomic<bool>        done { false };
+        };
+
+        void schedule(uint32_t index);
+        void run(uint32_t index);
+        void rethrowIfFailed();
+
+        // 원자 변수를 가진 노드의 주소가 바뀌지 않도록 deque 사용
+        std::deque<Node>          _nodes;
+        ThreadPool*               _pool = nullptr;
+        std::atomic<uint32_t>     _unfinished { 0 };
+
+        std::mutex                _errorMutex;
+        std::exception_ptr        _error;
+    };
+
+    inline TaskGraph::~TaskGraph()
+    {
+        // 실행 중인 작업이 this 를 참조하므로 끝날 때까지 대기
+        if (_pool)
+            _pool->WaitUntil([this] { return _unfinished.load(std::memory_order_acquire) == 0; });
+    }
+
+    inline TaskHandle TaskGraph::AddTask(TaskFunc fn)
+    {
+        assert(_unfinished.load() == 0 && "TaskGraph: 실행 중에는 작업을 추가할 수 없습니다");
+
+        Node& node = _nodes.emplace_back();
+        node.fn = std::move(fn);
+        return TaskHandle{ static_cast<uint32_t>(_nodes.size() - 1) };
+    }
+
+    inline void TaskGraph::AddEdge(TaskHandle before, TaskHandle after)
+    {
+        assert(_unfinished.load() == 0 && "TaskGraph: 실행 중에는 간선을 추가할 수 없습니다");
+        assert(before.index < _nodes.size() && after.index < _nodes.size() && "TaskGraph: 잘못된 TaskHandle");
+        assert(before.index != after.index && "TaskGraph: 자기 자신에 대한 의존성");
+
+        _nodes[before.index].successors.push_back(after.index);
+        ++_nodes[after.index].predecessorCount;
+    }
+
+    inline void TaskGraph::Submit(ThreadPool& pool)
+    {
+        assert(_unfinished.load() == 0 && "TaskGraph: 이전 실행이 끝나기 전에 Submit 할 수 없습니다");
+        assert(IsAcyclic() && "TaskGraph: 순환 의존성이 있습니다");
+
+        _pool = &pool;
+        _error = nullptr;
+
+        // 카운터를 먼저 모두 초기화한 뒤 루트 작업을 등록 (루트가 곧바로 후속 작업을 건드릴 수 있음)
+        for (Node& node : _nodes)
+        {
+            node.remaining.store(node.predecessorCount, std::memory_order_relaxed);
+            node.done.store(false, std::memory_order_relaxed);
+        }
+        _unfinished.store(static_cast<uint32_t>(_nodes.size()), std::memory_order_release);
+
+        for (uint32_t i = 0; i < _nodes.size(); ++i)
+        {
+            if (_nodes[i].predecessorCount == 0)
+                schedule(i);
+        }
+    }
+
+    inline void TaskGraph::schedule(uint32_t index)
+    {
+        _pool->Enqueue([this, index] { run(index); });
+    }
+
+    inline void TaskGraph::run(uint32_t index)
+    {
+        Node& node = _nodes[index];
+        try
+        {
+            if (node.fn) node.fn();
+        }
+        catch (...)
+        {
+            // 예외가 나도 후속 작업은 풀어줘야 대기 중인 스레드가 멈추지 않는다
+            std::lock_guard<std::mutex> lk(_errorMutex);
+            if (!_error) _error = std::current_exception();
+        }
+
+        // 준비된 후속 작업은 즉시 스케줄 (워커에서 호출되므로 로컬 큐에 lock 없이 들어간다)
+        for (uint32_t succ : node.successors)
+        {
+            if (_nodes[succ].remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                schedule(succ);
+        }
+
+        // 마지막 감소 이후에는 그래프가 파괴될 수 있으므로 풀 포인터를 미리 복사
+        ThreadPool* pool = _pool;
+        node.done.store(true, std::memory_order_release);
+        _unfinished.fetch_sub(1, std::memory_order_acq_rel);
+        pool->NotifyWaiters();
+    }
+
+    inline void TaskGraph::Wait(TaskHandle task)
+    {
+        assert(task.index < _nodes.size() && "TaskGraph: 잘못된 TaskHandle");
+        assert(_pool && "TaskGraph: Submit 전에 Wait 할 수 없습니다");
+
+        const Node& node = _nodes[task.index];
+        _pool->WaitUntil([&node] { return node.done.load(std::memory_order_acquire); });
+        rethrowIfFailed();
+    }
+
+    inline void TaskGraph::Wait(std::span<const TaskHandle> tasks)
+    {
+        assert(_pool && "TaskGraph: Submit 전에 Wait 할 수 없습니다");
+        _pool->WaitUntil([this, tasks]
+        {
+            for (TaskHandle task : tasks)
+            {
+                if (!IsDone(task)) return false;
+            }
+            return true;
+        });
+        rethrowIfFailed();
+    }
+
+    inline void TaskGraph::WaitAll()
+    {
+        assert(_pool && "TaskGraph: Submit 전에 Wait 할 수 없습니다");
+        _pool->WaitUntil([this] { return _unfinished.load(std::memory_order_acquire) == 0; });
+        rethrowIfFailed();
+    }
+
+    inline bool TaskGraph::IsDone(TaskHandle task) const
+    {
+        return task.index < _nodes.size() && _nodes[task.index].done.load(std::memory_order_acquire);
+    }
+
+    inline void TaskGraph::Clear()
+    {
+        assert(_unfinished.load() == 0 && "TaskGraph: 실행 중에는 Clear 할 수 없습니다");
+        _nodes.clear();
+        _error = nullptr;
+    }
+
+    inline void TaskGraph::rethrowIfFailed()
+    {
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lk(_errorMutex);
+            error = _error;
+        }
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    inline bool TaskGraph::IsAcyclic() const
+    {
+        // Kahn 위상 정렬로 모든 노드를 방문할 수 있으면 DAG
+        std::vector<uint32_t> inDegree(_nodes.size());
+        std::vector<uint32_t> ready;
+        for (uint32_t i = 0; i < _nodes.size(); ++i)
+        {
+            inDegree[i] = _nodes[i].predecessorCount;
+            if (inDegree[i] == 0) ready.push_back(i);
+        }
+
+        size_t visited = 0;
+        while (!ready.empty())
+        {
+            const uint32_t i = ready.back();
+            ready.pop_back();
+            ++visited;
+            for (uint32_t succ : _nodes[i].successors)
+            {
+                if (--inDegree[succ] == 0) ready.push_back(succ);
+            }
+        }
+        return visited == _nodes.size();
+    }
+}
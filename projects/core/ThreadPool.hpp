@@ -1,102 +1,908 @@
 ﻿#pragma once
-#include <deque>
+#include <array>
+#include <algorithm>
 #include <mutex>
 #include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
 #include <vector>
+#include <cassert>
 #include <functional>
+#include <exception>
+#include <string_view>
+#include <type_traits>
+
+#include "Job.hpp"
+#include "CpuTopology.hpp"
+#include "RingQueue.hpp"
+#include "ThreadPoolStats.hpp"
+#include "WorkStealingQueue.hpp"
 
 namespace core
 {
+    // 작업 우선순위
+    // 높은 우선순위부터 꺼내되, 일정 횟수마다 낮은 우선순위를 먼저 확인해 기아(starvation)를 막는다
+    enum class JobPriority : uint8_t
+    {
+        High,        // 프레임 필수 작업 (컬링, 커맨드 기록)
+        Normal,
+        Background,  // 에셋 디코딩 등 지연 허용 작업
+
+        Count
+    };
+
+    // 스레드 풀 생성 옵션
+    struct ThreadPoolDesc
+    {
+        size_t      numThreads = 0;              // 0 이면 워커용 논리 프로세서 수만큼
+        uint32_t    reservedCores = 0;           // 메인/렌더 스레드용으로 비워 둘 물리 코어 수 (가장 빠른 코어부터)
+        bool        onePerPhysicalCore = false;  // SMT 형제 중 대표 논리 프로세서만 워커에 사용
+        bool        pinWorkers = false;          // 워커를 논리 프로세서 하나씩에 고정 (false 면 워커용 집합 전체로만 제한)
+        std::string namePrefix = "Worker";       // OS 에 보이는 스레드 이름 ("Worker 0", "Worker 1", ...)
+    };
+
+    // 특정 스레드만 Pump 지점에서 비우는 친화(affinity) 큐 식별자
+    using AffinityQueueId = uint32_t;
+
+    template<typename T>
+    class Future;
+
+    // 작업 묶음 완료 대기용 카운터
+    // Enqueue(job, &counter) 로 등록한 작업이 모두 끝나면 0 이 된다
+    class JobCounter
+    {
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        int  GetCount() const { return _count.load(std::memory_order_acquire); }
+        bool IsDone() const { return GetCount() == 0; }
+
+    private:
+        friend class ThreadPool;
+        std::atomic<int> _count { 0 };
+    };
+
     class ThreadPool
-	{
+    {
     public:
-        using Job = std::function<void()>;
+        using Job = core::Job;
+
+        // 기본 친화 큐
+        static constexpr AffinityQueueId MainQueue = 0;
+        static constexpr AffinityQueueId RenderQueue = 1;
+        static constexpr size_t MaxAffinityQueues = 16;
+
+        // 낮은 우선순위를 먼저 확인하는 주기 (스레드별 작업 꺼내기 횟수 기준)
+        static constexpr uint32_t StarvationInterval = 16;
 
         explicit ThreadPool(size_t numThreads = std::thread::hardware_concurrency());
+        explicit ThreadPool(const ThreadPoolDesc& desc);
 
         ~ThreadPool();
 
         // 작업 등록 (반환값 필요 없는 경우)
-        void Enqueue(Job job);
+        // 워커 스레드에서 호출하면 해당 워커의 로컬 큐에 lock 없이 push 되고,
+        // 외부 스레드에서 호출하면 공용 주입 큐(global queue)로 들어간다
+        // counter 를 넘기면 작업이 끝날 때 감소한다
+        // 작업은 미리 할당된 슬롯에 저장되므로 정상 상태에서는 힙 할당이 없다
+        // 우선순위를 생략하면 현재 실행 중인 작업의 우선순위를 물려받는다 (작업 밖에서는 Normal)
+        void Enqueue(Job job, JobCounter* counter = nullptr);
+        void Enqueue(Job job, JobPriority priority, JobCounter* counter = nullptr);
+
+        // 결과가 필요한 작업 등록 (Future.hpp 에 정의)
+        // fn 의 반환값 또는 fn 이 던진 예외가 Future 로 전달된다
+        template<typename F>
+        auto Submit(F&& fn) -> Future<std::invoke_result_t<std::decay_t<F>&>>;
+        template<typename F>
+        auto Submit(F&& fn, JobPriority priority) -> Future<std::invoke_result_t<std::decay_t<F>&>>;
+
+        // Enqueue 로 등록한 작업이 던진 예외 처리기 (Submit 작업의 예외는 Future 로 전달되므로 해당 없음)
+        // 처리기가 없으면 예외는 버려지고 GetUnhandledExceptionCount() 만 증가한다
+        // 워커 스레드에서 호출되므로 처리기는 스레드 안전해야 하며, 작업이 없을 때 설정할 것
+        using ExceptionHandler = std::function<void(std::exception_ptr)>;
+        void SetExceptionHandler(ExceptionHandler handler) { _exceptionHandler = std::move(handler); }
+        size_t GetUnhandledExceptionCount() const { return _unhandledExceptions.load(std::memory_order_relaxed); }
+
+        // 친화 큐
+        // 등록은 초기화 시점에만 (동시에 Enqueue 하는 스레드가 없을 때) 할 것
+        AffinityQueueId RegisterAffinityQueue(std::string_view name);
+        AffinityQueueId FindAffinityQueue(std::string_view name) const;  // 없으면 UINT32_MAX
+
+        // 친화 큐에 작업 등록. 워커는 이 작업을 실행하지 않고, Pump 를 호출한 스레드가 실행한다
+        // WaitAll 대상에는 포함되지 않으며, counter 로 완료를 기다릴 수 있다
+        void EnqueueTo(AffinityQueueId queue, Job job, JobCounter* counter = nullptr);
+
+        // Pump 지점: 큐에 쌓인 작업을 최대 maxJobs 개까지 현재 스레드에서 실행하고 실행한 수를 반환
+        // 호출 시점에 쌓여 있던 작업만 실행하므로 Pump 도중 추가된 작업은 다음 Pump 로 넘어간다
+        size_t Pump(AffinityQueueId queue, size_t maxJobs = SIZE_MAX);
+
+        // 현재 스레드를 친화 큐의 소유 스레드로 지정 (예: 메인 스레드 -> MainQueue)
+        // 소유 스레드는 Wait 중에도 자기 큐를 함께 비우므로, 자기 큐 작업을 기다려도 교착되지 않는다
+        void BindCurrentThread(AffinityQueueId queue);
+
+        // 프레임 지연 작업
+        // AdvanceFrame 은 프레임마다 한 번 (보통 메인 스레드의 프레임 시작 지점에서) 호출한다
+        // EnqueueAfterFrames 로 등록한 작업은 frames 번의 AdvanceFrame 이후 일반 작업으로 풀에 등록된다
+        // 등록되기 전까지는 WaitAll 대상이 아니다
+        void AdvanceFrame();
+        uint64_t GetFrameIndex() const { return _frameIndex.load(std::memory_order_acquire); }
+        void EnqueueAfterFrames(uint32_t frames, Job job, JobPriority priority = JobPriority::Normal);
+
+        // 대기 함수들은 모두 "도우면서 대기": 대기 중인 스레드가 큐의 작업을 직접 꺼내 실행하고,
+        // 실행할 작업이 없을 때만 atomic wait(futex / WaitOnAddress)로 잠든다
+        // 따라서 작업 안에서 자신의 하위 작업을 기다려도 교착되지 않는다
 
-        // 모든 작업 완료 대기
-        void WaitAll() const;
+        // counter 에 묶인 작업 완료 대기
+        void Wait(const JobCounter& counter);
+
+        // 모든 작업 완료 대기 (친화 큐 작업 제외)
+        // 작업 안에서 호출하면 호출한 작업(들) 자신은 제외하고 나머지가 끝날 때까지 대기
+        void WaitAll();
+
+        // done() 이 true 가 될 때까지 도우면서 대기
+        // done 의 상태를 바꾸는 쪽은 변경 후 NotifyWaiters() 를 호출해야 한다
+        template<typename Pred>
+        void WaitUntil(Pred&& done);
+        void NotifyWaiters();
+
+        // 스케줄러 통계 (기본 꺼짐)
+        // 켜면 작업마다 시간 측정이 추가되고, 꺼져 있으면 분기 하나의 비용만 든다
+        // 카운터는 lock-free 이며 워커를 멈추지 않고 아무 스레드에서나 읽을 수 있다
+        void EnableStats(bool enable) { _statsEnabled.store(enable, std::memory_order_relaxed); }
+        bool IsStatsEnabled() const { return _statsEnabled.load(std::memory_order_relaxed); }
+
+        // 풀 생성 이후 누적 통계
+        ThreadPoolStats GetStats() const;
+
+        // 직전 프레임 (마지막 두 AdvanceFrame 사이) 통계. maxQueueDepth 는 해당 프레임의 최대값
+        ThreadPoolStats GetFrameStats() const;
+
+        // 큐에서 작업 하나를 꺼내 현재 스레드에서 실행. 실행했으면 true
+        // 현재 스레드에 묶인 친화 큐가 있으면 그 큐를 먼저 확인한다
+        bool TryRunOne();
+
+        size_t GetWorkerCount() const { return _workers.size(); }
+
+        // ThreadPoolDesc::reservedCores 로 비워 둔 물리 코어 (slot 0 = 메인, 1 = 렌더 등 용도는 호출자가 정함)
+        size_t GetReservedCoreCount() const { return _reservedCores.size(); }
+
+        // 현재 스레드를 예약 코어에 고정하고 이름을 붙인다. 예약 코어가 없거나 실패하면 false
+        bool PinCurrentThreadToReservedCore(size_t slot, std::string_view threadName = {});
+
+        // 현재 스레드가 이 풀의 워커면 워커 인덱스, 아니면 -1
+        int GetCurrentWorkerIndex() const;
+
+        // 현재 스레드가 push 할 큐에 남은 작업 수 (워커면 로컬 큐, 아니면 공용 주입 큐)
+        // ParallelFor 의 분할 여부 판단에 사용
+        size_t GetLocalQueueSize() const;
 
     private:
+        using JobItem = internal::JobItem;
+
+        static constexpr size_t PriorityCount = static_cast<size_t>(JobPriority::Count);
+
+        struct Worker
+        {
+            std::thread                                                      thread;
+            std::array<internal::WorkStealingQueue<JobItem*>, PriorityCount> queues;
+            internal::JobSlab                                                slab;    // 이 워커가 등록하는 작업의 저장소
+            internal::WorkerStatCounters                                     stats;
+            std::vector<uint32_t>                                            cpus;    // 비어 있으면 affinity 설정 안 함
+            std::string                                                      name;
+        };
+
+        struct AffinityQueue
+        {
+            std::string                      name;
+            internal::RingQueue<JobItem*>    queue;
+            internal::JobSlab                slab { 64 };
+            std::mutex                       mutex;
+            std::atomic<size_t>              size { 0 };
+        };
+
         // 워커 루프
-        void workerLoop();
+        void workerLoop(size_t index);
+
+        JobItem* findJob();
+        JobItem* findJob(size_t priority);
+        JobItem* popGlobal(size_t priority);
+        JobItem* popAffinity(AffinityQueueId queue);
+        JobItem* steal(int thief, size_t priority);
+        void runJob(JobItem* job);
+        bool hasPendingWork() const;
+        bool hasAffinityWork() const;
+
+        // 현재 스레드의 통계 카운터 (워커가 아니면 외부 스레드 공용 슬롯)
+        internal::WorkerStatCounters& currentStats();
+        void collectStats(ThreadPoolStats& out) const;
+        void updateFrameStats();
+
+        // 실행할 작업이 없을 때 잠들기. 잠들기 직전에 wakeCondition() 이 true 면 바로 반환
+        template<typename Cond>
+        void park(Cond&& wakeCondition);
+        void wake(bool all);
 
-        std::vector<std::thread>      _workers;
-        std::deque<Job>               _jobQueue;
+        std::vector<std::unique_ptr<Worker>>        _workers;
+        std::vector<std::vector<uint32_t>>          _reservedCores;
+        std::array<internal::RingQueue<JobItem*>, PriorityCount> _globalQueues;
+        internal::JobSlab             _globalSlab;    // 외부 스레드가 등록하는 작업의 저장소 (_queueMutex 보호)
         std::mutex                    _queueMutex;
-        std::condition_variable       _queueCv;
         std::atomic<bool>             _stopping;
         std::atomic<int>              _pendingJobs;
+        std::atomic<int>              _heldJobs;      // WaitAll 중인 작업 수 (자기 자신은 기다리지 않도록)
+        std::atomic<size_t>           _globalSize;
+
+        std::vector<std::unique_ptr<AffinityQueue>> _affinityQueues;
+
+        struct DelayedJob
+        {
+            uint64_t     frame;      // 이 프레임 번호에 도달하면 등록
+            Job          job;
+            JobPriority  priority;
+        };
+
+        std::mutex                    _delayedMutex;
+        std::vector<DelayedJob>       _delayedJobs;
+        std::vector<DelayedJob>       _dueJobs;       // AdvanceFrame 에서 재사용하는 임시 버퍼
+        std::atomic<uint64_t>         _frameIndex { 0 };
+
+        std::atomic<bool>             _statsEnabled { false };
+        internal::WorkerStatCounters  _externalStats;
+        mutable std::mutex            _statsMutex;        // 프레임 스냅샷 보호
+        ThreadPoolStats               _lastSnapshot;
+        ThreadPoolStats               _frameStats;
+
+        ExceptionHandler              _exceptionHandler;
+        std::atomic<size_t>           _unhandledExceptions { 0 };
+
+        // 잠든 스레드를 깨우는 신호: 값이 바뀌면 atomic wait 에서 깨어난다
+        std::atomic<uint32_t>         _wakeEpoch;
+        std::atomic<int>              _parkedThreads;
+
+        // 현재 스레드가 속한 풀 / 워커 인덱스
+        static inline thread_local ThreadPool* s_CurrentPool = nullptr;
+        static inline thread_local int         s_WorkerIndex = -1;
+        // 현재 스레드 스택에서 실행 중인 작업 수 / 그중 WaitAll 에서 제외 처리된 수
+        static inline thread_local int         s_RunningDepth = 0;
+        static inline thread_local int         s_HeldDepth = 0;
+        // 현재 실행 중인 작업의 우선순위 (하위 작업이 물려받음)
+        static inline thread_local JobPriority s_CurrentPriority = JobPriority::Normal;
+        // 현재 스레드에 묶인 친화 큐
+        static inline thread_local ThreadPool*     s_BoundPool = nullptr;
+        static inline thread_local AffinityQueueId s_BoundQueue = UINT32_MAX;
+        // 기아 방지용 작업 꺼내기 횟수
+        static inline thread_local uint32_t    s_PickCount = 0;
+        // 희생자(victim) 선택용 xorshift 상태
+        static inline thread_local uint32_t    s_Rng = 0;
     };
 
-    inline ThreadPool::ThreadPool(size_t numThreads): _stopping(false), _pendingJobs(0)
+    inline ThreadPool::ThreadPool(size_t numThreads)
+        : ThreadPool(ThreadPoolDesc{ numThreads == 0 ? 1 : numThreads })
+    {
+    }
+
+    inline ThreadPool::ThreadPool(const ThreadPoolDesc& desc)
+        : _stopping(false), _pendingJobs(0), _heldJobs(0), _globalSize(0), _wakeEpoch(0), _parkedThreads(0)
     {
-	    // 워커 스레드 생성
-	    for (size_t i = 0; i < numThreads; ++i)
-	    {
-		    _workers.emplace_back([this] { workerLoop(); });
-	    }
+        ScopedMemoryTag memoryTag(MemoryTag::Threading);
+
+        // 토폴로지 기준으로 예약 코어와 워커용 논리 프로세서를 나눈다 (코어는 빠른 순서로 정렬되어 있음)
+        const std::vector<PhysicalCore>& cores = CpuTopology::Get().GetPhysicalCores();
+        const size_t reserved = (std::min)(static_cast<size_t>(desc.reservedCores), cores.size() - 1);
+
+        std::vector<uint32_t> workerCpus;
+        for (size_t c = 0; c < cores.size(); ++c)
+        {
+            if (c < reserved)
+            {
+                _reservedCores.push_back(cores[c].logicalProcessors);
+                continue;
+            }
+
+            if (desc.onePerPhysicalCore)
+                workerCpus.push_back(cores[c].logicalProcessors.front());
+            else
+                workerCpus.insert(workerCpus.end(), cores[c].logicalProcessors.begin(), cores[c].logicalProcessors.end());
+        }
+
+        const size_t numThreads = desc.numThreads > 0 ? desc.numThreads : (std::max)(size_t{ 1 }, workerCpus.size());
+        const bool restrict = desc.pinWorkers || desc.onePerPhysicalCore || reserved > 0;
+
+        // 기본 친화 큐 (MainQueue, RenderQueue 순서)
+        _affinityQueues.reserve(MaxAffinityQueues);
+        RegisterAffinityQueue("main");
+        RegisterAffinityQueue("render");
+
+        // 도둑 스레드가 다른 워커의 큐를 참조하므로 큐를 먼저 모두 만든 뒤 스레드를 띄운다
+        _workers.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i)
+        {
+            auto worker = std::make_unique<Worker>();
+            worker->name = desc.namePrefix + " " + std::to_string(i);
+            if (desc.pinWorkers && !workerCpus.empty())
+                worker->cpus.push_back(workerCpus[i % workerCpus.size()]);
+            else if (restrict)
+                worker->cpus = workerCpus;
+            _workers.push_back(std::move(worker));
+        }
+
+        // 워커 스레드 생성
+        for (size_t i = 0; i < numThreads; ++i)
+        {
+            _workers[i]->thread = std::thread([this, i] { workerLoop(i); });
+        }
     }
 
     inline ThreadPool::~ThreadPool()
     {
-	    // 종료 신호 및 모든 워커 join
-	    {
-		    std::lock_guard<std::mutex> lk(_queueMutex);
-		    _stopping = true;
-	    }
-	    _queueCv.notify_all();
-	    for (auto& t : _workers)
-	    {
-		    if (t.joinable()) t.join();
-	    }
-    }
-
-    inline void ThreadPool::Enqueue(Job job)
-    {
-	    {
-		    std::lock_guard<std::mutex> lk(_queueMutex);
-		    _jobQueue.push_back(std::move(job));
-		    ++_pendingJobs;
-	    }
-	    _queueCv.notify_one();
-    }
-
-    inline void ThreadPool::WaitAll() const
-    {
-	    while (_pendingJobs.load() > 0) 
-	    {
-		    std::this_thread::yield();
-	    }
-    }
-
-    inline void ThreadPool::workerLoop()
-    {
-	    while (true) 
-	    {
-		    Job job;
-		    {
-			    std::unique_lock<std::mutex> lk(_queueMutex);
-			    _queueCv.wait(lk, [this] { return _stopping || !_jobQueue.empty(); });
-			    if (_stopping && _jobQueue.empty())
-				    return;
-			    job = std::move(_jobQueue.front());
-			    _jobQueue.pop_front();
-		    }
-		    try 
-		    {
-			    job();
-		    }
-		    catch (...) 
-		    {
-			    // 로깅 또는 예외 처리
-		    }
-		    --_pendingJobs;
-	    }
+        // 종료 신호 및 모든 워커 join
+        _stopping.store(true);
+        wake(true);
+        for (auto& w : _workers)
+        {
+            if (w->thread.joinable()) w->thread.join();
+        }
+
+        // 워커는 큐가 빌 때까지 처리하고 종료하며, 남은 슬롯은 JobSlab 이 함께 정리한다
+        if (s_BoundPool == this)
+        {
+            s_BoundPool = nullptr;
+            s_BoundQueue = UINT32_MAX;
+        }
+    }
+
+    inline void ThreadPool::Enqueue(Job job, JobCounter* counter)
+    {
+        Enqueue(std::move(job), s_RunningDepth > 0 ? s_CurrentPriority : JobPriority::Normal, counter);
+    }
+
+    inline void ThreadPool::Enqueue(Job job, JobPriority priority, JobCounter* counter)
+    {
+        assert(priority < JobPriority::Count);
+        const size_t lane = static_cast<size_t>(priority);
+
+        if (counter)
+            counter->_count.fetch_add(1, std::memory_order_relaxed);
+        _pendingJobs.fetch_add(1, std::memory_order_relaxed);
+
+        if (s_CurrentPool == this)
+        {
+            // 워커 로컬 슬롯 + 로컬 큐: lock 없음
+            Worker& worker = *_workers[s_WorkerIndex];
+            JobItem* item = worker.slab.Allocate(std::move(job), counter);
+            item->priority = static_cast<uint8_t>(lane);
+            item->affinity = false;
+            // Push 직후부터 다른 워커가 훔쳐 가 실행하고 해제할 수 있으므로 등록 시각은 그 전에 찍는다
+            const bool measure = IsStatsEnabled();
+            if (measure)
+                item->enqueueNs = internal::stats_now_ns();
+            worker.queues[lane].Push(item);
+
+            if (measure)
+                worker.stats.RecordQueueDepth(GetLocalQueueSize());
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lk(_queueMutex);
+            JobItem* item = _globalSlab.Allocate(std::move(job), counter);
+            item->priority = static_cast<uint8_t>(lane);
+            item->affinity = false;
+            _globalQueues[lane].PushBack(item);
+            const size_t depth = _globalSize.fetch_add(1, std::memory_order_relaxed) + 1;
+
+            if (IsStatsEnabled())
+            {
+                item->enqueueNs = internal::stats_now_ns();
+                _externalStats.RecordQueueDepth(depth);
+            }
+        }
+
+        wake(false);
+    }
+
+    inline AffinityQueueId ThreadPool::RegisterAffinityQueue(std::string_view name)
+    {
+        const AffinityQueueId existing = FindAffinityQueue(name);
+        if (existing != UINT32_MAX)
+            return existing;
+
+        // reserve 한 용량을 넘기면 다른 스레드가 보고 있는 벡터가 재할당되므로 상한을 둔다
+        assert(_affinityQueues.size() < MaxAffinityQueues && "ThreadPool: 친화 큐 개수 초과");
+        auto queue = std::make_unique<AffinityQueue>();
+        queue->name = name;
+        _affinityQueues.push_back(std::move(queue));
+        return static_cast<AffinityQueueId>(_affinityQueues.size() - 1);
+    }
+
+    inline AffinityQueueId ThreadPool::FindAffinityQueue(std::string_view name) const
+    {
+        for (size_t i = 0; i < _affinityQueues.size(); ++i)
+        {
+            if (_affinityQueues[i]->name == name)
+                return static_cast<AffinityQueueId>(i);
+        }
+        return UINT32_MAX;
+    }
+
+    inline void ThreadPool::EnqueueTo(AffinityQueueId queue, Job job, JobCounter* counter)
+    {
+        assert(queue < _affinityQueues.size() && "ThreadPool: 잘못된 친화 큐");
+        AffinityQueue& target = *_affinityQueues[queue];
+
+        if (counter)
+            counter->_count.fetch_add(1, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> lk(target.mutex);
+            JobItem* item = target.slab.Allocate(std::move(job), counter);
+            item->priority = static_cast<uint8_t>(JobPriority::High);
+            item->affinity = true;
+            if (IsStatsEnabled())
+                item->enqueueNs = internal::stats_now_ns();
+            target.queue.PushBack(item);
+            target.size.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // 소유 스레드가 Wait 중에 잠들어 있을 수 있으므로 모두 깨운다
+        wake(true);
+    }
+
+    inline size_t ThreadPool::Pump(AffinityQueueId queue, size_t maxJobs)
+    {
+        assert(queue < _affinityQueues.size() && "ThreadPool: 잘못된 친화 큐");
+
+        // 지금 쌓여 있는 만큼만 실행 (Pump 중에 자기 큐에 다시 넣는 작업이 무한 반복되지 않도록)
+        const size_t budget = (std::min)(maxJobs, _affinityQueues[queue]->size.load(std::memory_order_acquire));
+
+        size_t executed = 0;
+        while (executed < budget)
+        {
+            JobItem* job = popAffinity(queue);
+            if (!job)
+                break;
+            runJob(job);
+            ++executed;
+        }
+        return executed;
+    }
+
+    inline void ThreadPool::BindCurrentThread(AffinityQueueId queue)
+    {
+        assert(queue < _affinityQueues.size() && "ThreadPool: 잘못된 친화 큐");
+        s_BoundPool = this;
+        s_BoundQueue = queue;
+    }
+
+    inline void ThreadPool::AdvanceFrame()
+    {
+        if (IsStatsEnabled())
+            updateFrameStats();
+
+        {
+            std::lock_guard<std::mutex> lk(_delayedMutex);
+            const uint64_t frame = _frameIndex.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+            // 기한이 된 작업을 옮기고 나머지는 앞으로 당긴다 (버퍼를 재사용해 정상 상태에서 할당 없음)
+            size_t kept = 0;
+            for (size_t i = 0; i < _delayedJobs.size(); ++i)
+            {
+                if (_delayedJobs[i].frame <= frame)
+                    _dueJobs.push_back(std::move(_delayedJobs[i]));
+                else if (kept != i)
+                    _delayedJobs[kept++] = std::move(_delayedJobs[i]);
+                else
+                    ++kept;
+            }
+            _delayedJobs.resize(kept);
+        }
+
+        // lock 밖에서 등록 (작업이 다시 EnqueueAfterFrames 를 호출할 수 있음)
+        // _dueJobs 는 AdvanceFrame 을 호출하는 한 스레드만 사용한다
+        for (DelayedJob& delayed : _dueJobs)
+            Enqueue(std::move(delayed.job), delayed.priority);
+        _dueJobs.clear();
+    }
+
+    inline void ThreadPool::EnqueueAfterFrames(uint32_t frames, Job job, JobPriority priority)
+    {
+        if (frames == 0)
+        {
+            Enqueue(std::move(job), priority);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lk(_delayedMutex);
+        _delayedJobs.push_back({ _frameIndex.load(std::memory_order_relaxed) + frames, std::move(job), priority });
+    }
+
+    inline void ThreadPool::Wait(const JobCounter& counter)
+    {
+        WaitUntil([&counter] { return counter.IsDone(); });
+    }
+
+    inline void ThreadPool::WaitAll()
+    {
+        // 현재 스택에서 실행 중인 작업은 대기 대상에서 제외 (자기 자신을 기다리는 교착 방지)
+        // 워커가 아닌 스레드도 대기 중에 작업을 실행하므로 풀 소속 여부와 관계없이 센다
+        const int held = s_RunningDepth - s_HeldDepth;
+        _heldJobs.fetch_add(held);
+        s_HeldDepth += held;
+        if (held > 0) NotifyWaiters();  // 다른 WaitAll 의 조건이 바뀜
+
+        WaitUntil([this] { return _pendingJobs.load(std::memory_order_acquire) <= _heldJobs.load(std::memory_order_acquire); });
+
+        s_HeldDepth -= held;
+        _heldJobs.fetch_sub(held);
+    }
+
+    template <typename Pred>
+    void ThreadPool::WaitUntil(Pred&& done)
+    {
+        constexpr int SpinCount = 64;
+        int idleSpins = 0;
+
+        while (!done())
+        {
+            if (TryRunOne())
+            {
+                idleSpins = 0;
+                continue;
+            }
+
+            if (++idleSpins < SpinCount)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            idleSpins = 0;
+
+            park([&] { return done() || hasPendingWork() || hasAffinityWork(); });
+        }
+    }
+
+    inline void ThreadPool::NotifyWaiters()
+    {
+        wake(true);
+    }
+
+    inline bool ThreadPool::TryRunOne()
+    {
+        JobItem* job = nullptr;
+        if (s_BoundPool == this)
+            job = popAffinity(s_BoundQueue);
+        if (!job)
+            job = findJob();
+        if (!job)
+            return false;
+
+        runJob(job);
+        return true;
+    }
+
+    inline int ThreadPool::GetCurrentWorkerIndex() const
+    {
+        return s_CurrentPool == this ? s_WorkerIndex : -1;
+    }
+
+    inline size_t ThreadPool::GetLocalQueueSize() const
+    {
+        const int index = GetCurrentWorkerIndex();
+        if (index >= 0)
+        {
+            int64_t size = 0;
+            for (const auto& queue : _workers[index]->queues)
+                size += queue.Size();
+            return size > 0 ? static_cast<size_t>(size) : 0;
+        }
+        return _globalSize.load(std::memory_order_relaxed);
+    }
+
+    template <typename Cond>
+    void ThreadPool::park(Cond&& wakeCondition)
+    {
+        // epoch 를 먼저 읽고, 잠든 스레드 수를 올린 뒤 조건을 다시 확인한다
+        // wake() 쪽은 상태 변경 -> fence -> _parkedThreads 확인 순서이므로 둘 중 하나는 반드시 상대를 본다
+        const uint32_t epoch = _wakeEpoch.load(std::memory_order_acquire);
+        _parkedThreads.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (!wakeCondition() && !_stopping.load(std::memory_order_relaxed))
+            _wakeEpoch.wait(epoch, std::memory_order_acquire);
+
+        _parkedThreads.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    inline void ThreadPool::wake(bool all)
+    {
+        // push / 카운터 감소와 잠든 스레드 수 확인 사이의 순서를 보장 (park 쪽 fetch_add 와 짝)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_parkedThreads.load(std::memory_order_relaxed) == 0)
+            return;
+
+        _wakeEpoch.fetch_add(1, std::memory_order_release);
+        if (all) _wakeEpoch.notify_all();
+        else     _wakeEpoch.notify_one();
+    }
+
+    inline ThreadPool::JobItem* ThreadPool::popGlobal(size_t priority)
+    {
+        if (_globalSize.load(std::memory_order_relaxed) == 0)
+            return nullptr;
+
+        std::lock_guard<std::mutex> lk(_queueMutex);
+        if (_globalQueues[priority].Empty())
+            return nullptr;
+
+        JobItem* job = _globalQueues[priority].PopFront();
+        _globalSize.fetch_sub(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    inline ThreadPool::JobItem* ThreadPool::popAffinity(AffinityQueueId queue)
+    {
+        AffinityQueue& source = *_affinityQueues[queue];
+        if (source.size.load(std::memory_order_relaxed) == 0)
+            return nullptr;
+
+        std::lock_guard<std::mutex> lk(source.mutex);
+        if (source.queue.Empty())
+            return nullptr;
+
+        source.size.fetch_sub(1, std::memory_order_relaxed);
+        return source.queue.PopFront();
+    }
+
+    inline ThreadPool::JobItem* ThreadPool::steal(int thief, size_t priority)
+    {
+        const size_t count = _workers.size();
+
+        // xorshift32 로 시작 희생자를 고르고 한 바퀴 순회
+        uint32_t& x = s_Rng;
+        if (x == 0) x = static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        const size_t start = x % count;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const size_t victim = (start + i) % count;
+            if (static_cast<int>(victim) == thief)
+                continue;
+
+            JobItem* job = nullptr;
+            if (_workers[victim]->queues[priority].Steal(job))
+            {
+                if (IsStatsEnabled())
+                    currentStats().Add(currentStats().steals, 1);
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    inline ThreadPool::JobItem* ThreadPool::findJob(size_t priority)
+    {
+        const int index = GetCurrentWorkerIndex();
+
+        JobItem* job = nullptr;
+        if (index >= 0 && _workers[index]->queues[priority].Pop(job))
+            return job;
+
+        if ((job = popGlobal(priority)))
+            return job;
+
+        return steal(index, priority);
+    }
+
+    inline ThreadPool::JobItem* ThreadPool::findJob()
+    {
+        // 평소에는 High -> Normal -> Background 순서로,
+        // StarvationInterval 번마다 한 번은 Background -> Normal -> High 순서로 찾는다
+        const bool lowFirst = (++s_PickCount % StarvationInterval) == 0;
+
+        for (size_t i = 0; i < PriorityCount; ++i)
+        {
+            const size_t priority = lowFirst ? PriorityCount - 1 - i : i;
+            if (JobItem* job = findJob(priority))
+                return job;
+        }
+        return nullptr;
+    }
+
+    inline void ThreadPool::runJob(JobItem* job)
+    {
+        // 통계: 등록 -> 시작 대기 시간과 실행 시간
+        const bool measure = IsStatsEnabled();
+        uint64_t startNs = 0;
+        if (measure)
+        {
+            startNs = internal::stats_now_ns();
+            if (job->enqueueNs != 0 && startNs >= job->enqueueNs)
+                currentStats().RecordLatency(startNs - job->enqueueNs);
+        }
+
+        const JobPriority prevPriority = s_CurrentPriority;
+        s_CurrentPriority = static_cast<JobPriority>(job->priority);
+        ++s_RunningDepth;
+        try 
+        {
+            job->fn();
+        }
+        catch (...) 
+        {
+            if (_exceptionHandler)
+                _exceptionHandler(std::current_exception());
+            else
+                _unhandledExceptions.fetch_add(1, std::memory_order_relaxed);
+        }
+        --s_RunningDepth;
+        s_CurrentPriority = prevPriority;
+
+        if (measure)
+        {
+            internal::WorkerStatCounters& stats = currentStats();
+            stats.Add(stats.busyNs, internal::stats_now_ns() - startNs);
+            stats.Add(stats.jobsExecuted, 1);
+        }
+
+        JobCounter* counter = job->counter;
+        const bool affinity = job->affinity;
+        job->enqueueNs = 0;
+        internal::JobSlab::Free(job);
+
+        bool signal = false;
+        if (counter && counter->_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            signal = true;
+        if (!affinity && _pendingJobs.fetch_sub(1, std::memory_order_acq_rel) - 1 <= _heldJobs.load(std::memory_order_acquire))
+            signal = true;
+
+        // 카운터가 0 이 되었거나 WaitAll 조건이 충족되었을 때만 대기 스레드를 깨운다
+        if (signal)
+            wake(true);
+    }
+
+    inline bool ThreadPool::hasPendingWork() const
+    {
+        if (_globalSize.load(std::memory_order_relaxed) > 0)
+            return true;
+
+        for (const auto& w : _workers)
+        {
+            for (const auto& queue : w->queues)
+            {
+                if (!queue.Empty())
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    inline bool ThreadPool::hasAffinityWork() const
+    {
+        // 현재 스레드에 묶인 친화 큐만 확인 (다른 스레드의 친화 작업은 실행할 수 없으므로)
+        return s_BoundPool == this && _affinityQueues[s_BoundQueue]->size.load(std::memory_order_relaxed) > 0;
+    }
+
+    inline internal::WorkerStatCounters& ThreadPool::currentStats()
+    {
+        const int index = GetCurrentWorkerIndex();
+        return index >= 0 ? _workers[index]->stats : _externalStats;
+    }
+
+    inline void ThreadPool::collectStats(ThreadPoolStats& out) const
+    {
+        out.frameIndex = GetFrameIndex();
+        out.workers.resize(_workers.size() + 1);
+        for (size_t i = 0; i < _workers.size(); ++i)
+            _workers[i]->stats.Snapshot(out.workers[i]);
+        _externalStats.Snapshot(out.workers.back());
+    }
+
+    inline ThreadPoolStats ThreadPool::GetStats() const
+    {
+        ThreadPoolStats stats;
+        collectStats(stats);
+        return stats;
+    }
+
+    inline ThreadPoolStats ThreadPool::GetFrameStats() const
+    {
+        std::lock_guard<std::mutex> lk(_statsMutex);
+        return _frameStats;
+    }
+
+    inline void ThreadPool::updateFrameStats()
+    {
+        std::lock_guard<std::mutex> lk(_statsMutex);
+
+        // 누적값의 차이로 프레임 통계를 만든다
+        ThreadPoolStats current;
+        collectStats(current);
+
+        _lastSnapshot.workers.resize(current.workers.size());
+        _frameStats.frameIndex = current.frameIndex;
+        _frameStats.workers.resize(current.workers.size());
+
+        for (size_t i = 0; i < current.workers.size(); ++i)
+        {
+            const WorkerStats& now = current.workers[i];
+            const WorkerStats& prev = _lastSnapshot.workers[i];
+            WorkerStats& frame = _frameStats.workers[i];
+
+            frame.jobsExecuted = now.jobsExecuted - prev.jobsExecuted;
+            frame.busyNs = now.busyNs - prev.busyNs;
+            frame.idleNs = now.idleNs - prev.idleNs;
+            frame.steals = now.steals - prev.steals;
+            for (size_t b = 0; b < JobLatencyBuckets; ++b)
+                frame.latencyHistogram[b] = now.latencyHistogram[b] - prev.latencyHistogram[b];
+
+            internal::WorkerStatCounters& counters = i < _workers.size() ? _workers[i]->stats : _externalStats;
+            frame.maxQueueDepth = counters.frameMaxQueueDepth.exchange(0, std::memory_order_relaxed);
+        }
+
+        _lastSnapshot = std::move(current);
+    }
+
+    inline bool ThreadPool::PinCurrentThreadToReservedCore(size_t slot, std::string_view threadName)
+    {
+        if (!threadName.empty())
+            SetCurrentThreadName(threadName);
+
+        if (slot >= _reservedCores.size())
+            return false;
+        return SetCurrentThreadAffinity(_reservedCores[slot]);
+    }
+
+    inline void ThreadPool::workerLoop(size_t index)
+    {
+        s_CurrentPool = this;
+        s_WorkerIndex = static_cast<int>(index);
+
+        Worker& self = *_workers[index];
+        SetCurrentThreadName(self.name);
+        if (!self.cpus.empty())
+            SetCurrentThreadAffinity(self.cpus);
+
+        constexpr int SpinCount = 64;
+        int idleSpins = 0;
+        uint64_t idleStartNs = 0;   // 통계: 할 일이 없어진 시점
+
+        while (true) 
+        {
+            if (JobItem* job = findJob())
+            {
+                if (idleStartNs != 0)
+                {
+                    internal::WorkerStatCounters& stats = _workers[index]->stats;
+                    stats.Add(stats.idleNs, internal::stats_now_ns() - idleStartNs);
+                    idleStartNs = 0;
+                }
+
+                runJob(job);
+                idleSpins = 0;
+                continue;
+            }
+
+            if (idleStartNs == 0 && IsStatsEnabled())
+                idleStartNs = internal::stats_now_ns();
+
+            if (_stopping.load(std::memory_order_acquire) && !hasPendingWork())
+                return;
+
+            // 잠들기 전 잠깐 다른 워커 큐를 더 살펴본다
+            if (++idleSpins < SpinCount)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            idleSpins = 0;
+
+            park([this] { return hasPendingWork(); });
+        }
     }
 }
+
+// Submit 정의
+#include "Future.hpp"
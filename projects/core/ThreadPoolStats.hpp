@@ -0,0 +1,94 @@
+﻿#pragma once
+#include <bit>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <cstdint>
+
+namespace core
+{
+    // 작업 대기 시간(등록 -> 실행 시작) 히스토그램 구간 수
+    // 구간 i 는 [2^(i-1), 2^i) 마이크로초 (0 번은 1us 미만, 마지막 구간은 그 이상 전부)
+    constexpr size_t JobLatencyBuckets = 16;
+
+    // 워커 하나의 통계 스냅샷
+    struct WorkerStats
+    {
+        uint64_t jobsExecuted = 0;
+        uint64_t busyNs = 0;          // 작업 실행 시간
+        uint64_t idleNs = 0;          // 할 일을 찾거나 잠들어 있던 시간
+        uint64_t steals = 0;          // 다른 워커 큐에서 훔쳐 온 작업 수
+        uint64_t maxQueueDepth = 0;   // 로컬 큐 최대 길이
+        std::array<uint64_t, JobLatencyBuckets> latencyHistogram {};
+    };
+
+    // 풀 전체 통계
+    // workers 의 마지막 원소는 워커가 아닌 스레드(Wait 중 돕는 메인 스레드, Pump, 공용 주입 큐)의 합계
+    struct ThreadPoolStats
+    {
+        uint64_t frameIndex = 0;
+        std::vector<WorkerStats> workers;
+    };
+
+    namespace internal
+    {
+        inline uint64_t stats_now_ns()
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        inline size_t latency_bucket(uint64_t ns)
+        {
+            const uint64_t us = ns / 1000;
+            const size_t bucket = static_cast<size_t>(std::bit_width(us));
+            return bucket < JobLatencyBuckets ? bucket : JobLatencyBuckets - 1;
+        }
+
+        // 워커별 lock-free 카운터
+        // 대부분 해당 워커만 쓰고 다른 스레드는 relaxed 로 읽기만 하므로 워커를 멈추지 않고 수집 가능
+        // 다른 워커 카운터와 캐시 라인을 공유하지 않도록 정렬
+        struct alignas(64) WorkerStatCounters
+        {
+            std::atomic<uint64_t> jobsExecuted { 0 };
+            std::atomic<uint64_t> busyNs { 0 };
+            std::atomic<uint64_t> idleNs { 0 };
+            std::atomic<uint64_t> steals { 0 };
+            std::atomic<uint64_t> maxQueueDepth { 0 };
+            std::atomic<uint64_t> frameMaxQueueDepth { 0 };   // AdvanceFrame 마다 0 으로 되돌림
+            std::array<std::atomic<uint64_t>, JobLatencyBuckets> latency {};
+
+            void Add(std::atomic<uint64_t>& counter, uint64_t value)
+            {
+                counter.fetch_add(value, std::memory_order_relaxed);
+            }
+
+            void RecordQueueDepth(uint64_t depth)
+            {
+                // 여러 스레드가 기록할 수 있는 외부 슬롯도 있으므로 CAS 로 최대값 갱신
+                uint64_t prev = maxQueueDepth.load(std::memory_order_relaxed);
+                while (depth > prev && !maxQueueDepth.compare_exchange_weak(prev, depth, std::memory_order_relaxed)) {}
+
+                prev = frameMaxQueueDepth.load(std::memory_order_relaxed);
+                while (depth > prev && !frameMaxQueueDepth.compare_exchange_weak(prev, depth, std::memory_order_relaxed)) {}
+            }
+
+            void RecordLatency(uint64_t ns)
+            {
+                latency[latency_bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void Snapshot(WorkerStats& out) const
+            {
+                out.jobsExecuted = jobsExecuted.load(std::memory_order_relaxed);
+                out.busyNs = busyNs.load(std::memory_order_relaxed);
+                out.idleNs = idleNs.load(std::memory_order_relaxed);
+                out.steals = steals.load(std::memory_order_relaxed);
+                out.maxQueueDepth = maxQueueDepth.load(std::memory_order_relaxed);
+                for (size_t i = 0; i < JobLatencyBuckets; ++i)
+                    out.latencyHistogram[i] = latency[i].load(std::memory_order_relaxed);
+            }
+        };
+    }
+}
@@ -0,0 +1,124 @@
+﻿#include "pch.h"
+#include "VirtualMemory.hpp"
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <Windows.h>
+#else
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+size_t core::internal::vm_page_size()
+{
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+core::internal::VirtualRange core::internal::vm_reserve(size_t size, HugePageMode mode)
+{
+    VirtualRange range;
+    range.pageSize = vm_page_size();
+
+#if defined(_WIN32)
+    if (mode == HugePageMode::Explicit)
+    {
+        // SeLockMemoryPrivilege 가 필요하고 부분 커밋이 불가능하다
+        const size_t large = GetLargePageMinimum();
+        if (large > 0)
+        {
+            const size_t rounded = (size + large - 1) / large * large;
+            void* p = VirtualAlloc(nullptr, rounded, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if (p)
+            {
+                range.base = static_cast<uint8_t*>(p);
+                range.size = rounded;
+                range.pageSize = large;
+                range.committedUpFront = true;
+                return range;
+            }
+        }
+    }
+
+    size = (size + range.pageSize - 1) / range.pageSize * range.pageSize;
+    range.base = static_cast<uint8_t*>(VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS));
+    range.size = range.base ? size : 0;
+#else
+    if (mode == HugePageMode::Explicit)
+    {
+        // 풀(vm.nr_hugepages)에 구간 전체만큼 huge page 가 있어야 한다
+        // MAP_NORESERVE 를 쓰면 풀이 모자랄 때 접근 시점에 SIGBUS 가 나므로 mmap 시점에 예약하고, 실패하면 THP 로 대체
+        constexpr size_t huge = size_t{ 2 } << 20;
+        const size_t rounded = (size + huge - 1) / huge * huge;
+        void* p = mmap(nullptr, rounded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED)
+        {
+            range.base = static_cast<uint8_t*>(p);
+            range.size = rounded;
+            range.pageSize = huge;
+            range.committedUpFront = true;
+            return range;
+        }
+        mode = HugePageMode::Transparent;
+    }
+
+    size = (size + range.pageSize - 1) / range.pageSize * range.pageSize;
+    void* p = mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p == MAP_FAILED)
+        return range;
+
+    range.base = static_cast<uint8_t*>(p);
+    range.size = size;
+#ifdef MADV_HUGEPAGE
+    if (mode == HugePageMode::Transparent)
+        madvise(p, size, MADV_HUGEPAGE);
+#endif
+#endif
+    return range;
+}
+
+bool core::internal::vm_commit(const VirtualRange& range, uint8_t* p, size_t size)
+{
+    if (range.committedUpFront)
+        return true;
+#if defined(_WIN32)
+    return VirtualAlloc(p, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+    return mprotect(p, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+}
+
+void core::internal::vm_decommit(const VirtualRange& range, uint8_t* p, size_t size)
+{
+#if defined(_WIN32)
+    if (range.committedUpFront)
+        return;
+    VirtualFree(p, size, MEM_DECOMMIT);
+#else
+    madvise(p, size, MADV_DONTNEED);
+    if (!range.committedUpFront)
+        mprotect(p, size, PROT_NONE);
+#endif
+}
+
+void core::internal::vm_release(VirtualRange& range)
+{
+    if (!range.base)
+        return;
+#if defined(_WIN32)
+    VirtualFree(range.base, 0, MEM_RELEASE);
+#else
+    munmap(range.base, range.size);
+#endif
+    range = VirtualRange{};
+}
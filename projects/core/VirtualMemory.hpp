@@ -0,0 +1,42 @@
+﻿#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// 플랫폼 API(Windows.h, sys/mman.h 등)를 쓰는 구현은 VirtualMemory.cpp 에 있다
+// FrameAllocator 를 include 하는 모든 파일에 Windows.h 가 딸려 들어가지 않도록 이 헤더는 표준 헤더만 쓴다
+
+namespace core
+{
+    // 가상 메모리 아레나의 huge page 사용 방식
+    enum class HugePageMode : uint8_t
+    {
+        None,
+        Transparent,    // Linux THP (madvise). Windows 에서는 무시
+        Explicit,       // Linux MAP_HUGETLB / Windows MEM_LARGE_PAGES. 실패하면 일반 페이지로 대체
+    };
+
+    namespace internal
+    {
+        // 예약된 가상 주소 구간
+        struct VirtualRange
+        {
+            uint8_t* base = nullptr;
+            size_t   size = 0;
+            size_t   pageSize = 0;          // 커밋/디커밋 단위
+            bool     committedUpFront = false;  // 명시적 huge page 는 예약과 동시에 전부 커밋됨
+        };
+
+        size_t vm_page_size();
+
+        // 실패 시 base == nullptr
+        VirtualRange vm_reserve(size_t size, HugePageMode mode);
+
+        // [p, p + size) 를 읽기/쓰기 가능하게 만든다. p 와 size 는 pageSize 정렬
+        bool vm_commit(const VirtualRange& range, uint8_t* p, size_t size);
+
+        // 물리 페이지를 OS 에 돌려준다. 주소 구간은 예약 상태로 남는다
+        void vm_decommit(const VirtualRange& range, uint8_t* p, size_t size);
+
+        void vm_release(VirtualRange& range);
+    }
+}
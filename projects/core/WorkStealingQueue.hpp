@@ -0,0 +1,159 @@
+﻿#pragma once
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <type_traits>
+
+namespace core
+{
+	namespace internal
+	{
+        // Chase-Lev work-stealing deque
+        // - Push/Pop 은 소유 워커만 호출 (bottom 쪽, LIFO)
+        // - Steal 은 아무 스레드나 호출 가능 (top 쪽, FIFO)
+        // 참고: Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013)
+        template<typename T>
+        class WorkStealingQueue
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "WorkStealingQueue: T 는 trivially copyable 이어야 합니다 (보통 포인터)");
+
+        public:
+            explicit WorkStealingQueue(int64_t capacity = 1024);
+
+            WorkStealingQueue(const WorkStealingQueue&) = delete;
+            WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+            // 소유 워커 전용
+            void Push(T item);
+            bool Pop(T& out);
+
+            // 모든 스레드
+            bool Steal(T& out);
+
+            bool Empty() const;
+            int64_t Size() const;
+
+        private:
+            struct Array
+            {
+                explicit Array(int64_t cap) : capacity(cap), mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+
+                T Get(int64_t i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+                void Put(int64_t i, T item) { slots[i & mask].store(item, std::memory_order_relaxed); }
+
+                int64_t capacity;
+                int64_t mask;
+                std::unique_ptr<std::atomic<T>[]> slots;
+            };
+
+            Array* grow(Array* old, int64_t bottom, int64_t top);
+
+            alignas(64) std::atomic<int64_t> _top;
+            alignas(64) std::atomic<int64_t> _bottom;
+            alignas(64) std::atomic<Array*> _array;
+
+            // 확장 전 배열은 도둑 스레드가 아직 읽고 있을 수 있으므로 소멸 시점까지 보관
+            std::vector<std::unique_ptr<Array>> _arrays;
+        };
+
+        template <typename T>
+        WorkStealingQueue<T>::WorkStealingQueue(int64_t capacity) : _top(0), _bottom(0)
+        {
+            // capacity 는 2의 거듭제곱이어야 mask 연산이 성립
+            int64_t cap = 1;
+            while (cap < capacity) cap <<= 1;
+
+            _arrays.push_back(std::make_unique<Array>(cap));
+            _array.store(_arrays.back().get(), std::memory_order_relaxed);
+        }
+
+        template <typename T>
+        void WorkStealingQueue<T>::Push(T item)
+        {
+            const int64_t b = _bottom.load(std::memory_order_relaxed);
+            const int64_t t = _top.load(std::memory_order_acquire);
+            Array* a = _array.load(std::memory_order_relaxed);
+
+            if (b - t > a->capacity - 1)
+                a = grow(a, b, t);
+
+            a->Put(b, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            _bottom.store(b + 1, std::memory_order_relaxed);
+        }
+
+        template <typename T>
+        bool WorkStealingQueue<T>::Pop(T& out)
+        {
+            const int64_t b = _bottom.load(std::memory_order_relaxed) - 1;
+            Array* a = _array.load(std::memory_order_relaxed);
+            _bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = _top.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                // 비어 있음
+                _bottom.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            out = a->Get(b);
+            if (t == b)
+            {
+                // 마지막 원소: 도둑과 경쟁
+                const bool won = _top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                _bottom.store(b + 1, std::memory_order_relaxed);
+                return won;
+            }
+            return true;
+        }
+
+        template <typename T>
+        bool WorkStealingQueue<T>::Steal(T& out)
+        {
+            int64_t t = _top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t b = _bottom.load(std::memory_order_acquire);
+
+            if (t >= b)
+                return false;
+
+            Array* a = _array.load(std::memory_order_acquire);
+            T item = a->Get(t);
+            if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return false; // 다른 도둑 또는 소유자에게 짐
+
+            out = item;
+            return true;
+        }
+
+        template <typename T>
+        bool WorkStealingQueue<T>::Empty() const
+        {
+            return Size() <= 0;
+        }
+
+        template <typename T>
+        int64_t WorkStealingQueue<T>::Size() const
+        {
+            const int64_t b = _bottom.load(std::memory_order_relaxed);
+            const int64_t t = _top.load(std::memory_order_relaxed);
+            return b - t;
+        }
+
+        template <typename T>
+        typename WorkStealingQueue<T>::Array* WorkStealingQueue<T>::grow(Array* old, int64_t bottom, int64_t top)
+        {
+            auto bigger = std::make_unique<Array>(old->capacity * 2);
+            for (int64_t i = top; i < bottom; ++i)
+                bigger->Put(i, old->Get(i));
+
+            Array* result = bigger.get();
+            _arrays.push_back(std::move(bigger));
+            _array.store(result, std::memory_order_release);
+            return result;
+        }
+	}
+}
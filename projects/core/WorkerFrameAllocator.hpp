@@ -0,0 +1,124 @@
+﻿#pragma once
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+
+#include "FrameAllocator.hpp"
+#include "ThreadPool.hpp"
+
+namespace core
+{
+    // ThreadPool 워커마다 FrameAllocator 를 하나씩 두는 프레임 할당기
+    // 잡 안에서는 자기 워커의 아레나에 락 없이 bump 할당하고, 프레임 끝에 한 번에 되감는다
+    // 워커가 아닌 스레드(메인 스레드가 Wait 중에 돕는 경우 등)는 공용 아레나를 mutex 로 나눠 쓴다
+    class WorkerFrameAllocator : public std::pmr::memory_resource
+    {
+    public:
+        WorkerFrameAllocator(ThreadPool& pool, size_t arenaSizePerWorker, size_t externalArenaSize = 0,
+                             FrameAllocatorGrowth growth = FrameAllocatorGrowth::Fixed);
+
+        WorkerFrameAllocator(const WorkerFrameAllocator&) = delete;
+        WorkerFrameAllocator& operator=(const WorkerFrameAllocator&) = delete;
+
+        void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+        template<typename T, typename... Args>
+        T* Create(Args&&... args);
+
+        // 현재 워커의 아레나 (워커 스레드에서만 호출)
+        FrameAllocator& GetLocal();
+
+        // 풀의 모든 잡이 끝나기를 기다린 뒤 전체 아레나를 되감는다 (워커 밖, 프레임 경계에서 호출)
+        void Reset();
+
+        // Reset 직전까지 모든 아레나에서 사용된 총량
+        size_t GetUsedSize() const;
+
+        ThreadPool& GetPool() const { return _pool; }
+
+    protected:
+        // std::pmr::memory_resource: 해제는 no-op (Reset/RollbackTo 에서 한 번에 반환)
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override { return Allocate(bytes, alignment); }
+        void  do_deallocate(void*, std::size_t, std::size_t) override {}
+        bool  do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    private:
+        // 이웃 워커의 _ptr 갱신이 같은 캐시 라인을 건드리지 않도록 분리
+        struct alignas(64) Arena
+        {
+            Arena(size_t size, FrameAllocatorGrowth growth) : allocator(size, growth) {}
+            FrameAllocator allocator;
+        };
+
+        ThreadPool&                         _pool;
+        std::vector<std::unique_ptr<Arena>> _arenas;    // 워커 인덱스 순
+        Arena                               _external;
+        mutable std::mutex                  _externalMutex;
+    };
+
+#pragma region IMPLEMENTS
+    inline WorkerFrameAllocator::WorkerFrameAllocator(ThreadPool& pool, size_t arenaSizePerWorker, size_t externalArenaSize,
+                                                      FrameAllocatorGrowth growth)
+        : _pool(pool)
+        , _external(externalArenaSize > 0 ? externalArenaSize : arenaSizePerWorker, growth)
+    {
+        _arenas.reserve(pool.GetWorkerCount());
+        for (size_t i = 0; i < pool.GetWorkerCount(); ++i)
+            _arenas.push_back(std::make_unique<Arena>(arenaSizePerWorker, growth));
+    }
+
+    inline void* WorkerFrameAllocator::Allocate(std::size_t size, std::size_t alignment)
+    {
+        const int index = _pool.GetCurrentWorkerIndex();
+        if (index >= 0)
+            return _arenas[index]->allocator.Allocate(size, alignment);
+
+        std::lock_guard lock(_externalMutex);
+        return _external.allocator.Allocate(size, alignment);
+    }
+
+    template<typename T, typename... Args>
+    T* WorkerFrameAllocator::Create(Args&&... args)
+    {
+        const int index = _pool.GetCurrentWorkerIndex();
+        if (index >= 0)
+            return _arenas[index]->allocator.Create<T>(std::forward<Args>(args)...);
+
+        std::lock_guard lock(_externalMutex);
+        return _external.allocator.Create<T>(std::forward<Args>(args)...);
+    }
+
+    inline FrameAllocator& WorkerFrameAllocator::GetLocal()
+    {
+        const int index = _pool.GetCurrentWorkerIndex();
+        assert(index >= 0 && "WorkerFrameAllocator: 워커 스레드에서만 GetLocal 호출 가능");
+        return _arenas[index]->allocator;
+    }
+
+    inline void WorkerFrameAllocator::Reset()
+    {
+        assert(_pool.GetCurrentWorkerIndex() < 0 && "WorkerFrameAllocator: 워커 안에서 Reset 하면 자신의 아레나를 되감게 됨");
+
+        // 아직 실행 중인 잡이 아레나 메모리를 쓰고 있을 수 있으므로 먼저 모두 끝낸다
+        _pool.WaitAll();
+
+        for (auto& arena : _arenas)
+            arena->allocator.Reset();
+
+        std::lock_guard lock(_externalMutex);
+        _external.allocator.Reset();
+    }
+
+    inline size_t WorkerFrameAllocator::GetUsedSize() const
+    {
+        size_t used = 0;
+        for (const auto& arena : _arenas)
+            used += arena->allocator.GetUsedSize();
+
+        std::lock_guard lock(_externalMutex);
+        return used + _external.allocator.GetUsedSize();
+    }
+#pragma endregion
+}
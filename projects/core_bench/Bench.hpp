@@ -0,0 +1,73 @@
+﻿#pragma once
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <string_view>
+
+// core 벤치마크용 최소 하네스
+// CORE_BENCH(Name) 으로 등록한 함수는 main 에서 순서대로 (또는 인자로 준 이름을 포함하는 것만) 실행된다
+namespace bench
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct BenchCase
+    {
+        const char* name;
+        void (*fn)();
+    };
+
+    inline std::vector<BenchCase>& GetRegistry()
+    {
+        static std::vector<BenchCase> s_Cases;
+        return s_Cases;
+    }
+
+    struct BenchRegistrar
+    {
+        BenchRegistrar(const char* name, void (*fn)()) { GetRegistry().push_back({ name, fn }); }
+    };
+
+    // fn 을 repeat 번 실행해 가장 빠른 회차의 경과 시간(ns)을 돌려준다 (스케줄링 잡음 제거)
+    template<typename F>
+    double MeasureBestNs(int repeat, F&& fn)
+    {
+        double best = 1e300;
+        for (int r = 0; r < repeat; ++r)
+        {
+            const auto start = Clock::now();
+            fn();
+            const auto end = Clock::now();
+            best = (std::min)(best, std::chrono::duration<double, std::nano>(end - start).count());
+        }
+        return best;
+    }
+
+    // 정렬된 표본에서 백분위 값 (p: 0 ~ 1)
+    inline uint64_t Percentile(std::vector<uint64_t>& samples, double p)
+    {
+        if (samples.empty())
+            return 0;
+        std::sort(samples.begin(), samples.end());
+        const size_t index = (std::min)(samples.size() - 1, static_cast<size_t>(p * static_cast<double>(samples.size())));
+        return samples[index];
+    }
+
+    // 컴파일러가 측정 대상 계산을 지우지 못하게 한다
+    template<typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+#if defined(_MSC_VER)
+        static volatile const void* s_Sink;
+        s_Sink = &value;
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+}
+
+#define CORE_BENCH(Name) \
+    static void Name(); \
+    static bench::BenchRegistrar s_##Name##Registrar(#Name, &Name); \
+    static void Name()
@@ -0,0 +1,274 @@
+﻿#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include <memory_resource>
+
+#include <core/FrameAllocator.hpp>
+#include <core/FrameContainers.hpp>
+#include <core/ParallelFor.hpp>
+#include <core/WorkerFrameAllocator.hpp>
+
+#include "Bench.hpp"
+
+namespace
+{
+    // 프레임당 ~0.9MB. 프레임마다 되감으므로 캐시에 남아 있는 메모리를 재사용한다
+    constexpr size_t FrameCount = 50;
+    constexpr size_t ScratchPerFrame = 10000;
+    constexpr size_t ScratchCount = FrameCount * ScratchPerFrame;
+    constexpr size_t ArenaSize = size_t{ 4 } << 20;
+
+    // 32 ~ 144 바이트 임시 버퍼
+    inline size_t ScratchSize(size_t i)
+    {
+        return 32 + (i % 8) * 16;
+    }
+
+    // 버퍼를 조금 써서 할당만 측정되지 않도록 한다
+    inline void TouchScratch(void* p, size_t i)
+    {
+        auto* bytes = static_cast<uint8_t*>(p);
+        bytes[0] = static_cast<uint8_t>(i);
+        bytes[ScratchSize(i) - 1] = static_cast<uint8_t>(i >> 8);
+        bench::DoNotOptimize(bytes[0]);
+    }
+
+    void PrintRow(const char* name, double ns)
+    {
+        std::printf("  %-46s %7.2f ns/alloc\n", name, ns / static_cast<double>(ScratchCount));
+    }
+}
+
+// 병렬 잡 안의 임시 할당 비용 (워커별 아레나 vs 힙 vs 공유 아레나 + mutex)
+CORE_BENCH(WorkerArenaScratch)
+{
+    core::ThreadPool pool;
+    std::printf("  workers: %zu (hardware threads: %u), %zu frames x %zu allocations\n",
+        pool.GetWorkerCount(), std::thread::hardware_concurrency(), FrameCount, ScratchPerFrame);
+
+    // 기준: 풀 없이 단일 FrameAllocator 에 bump 할당
+    core::FrameAllocator single(ArenaSize);
+    const double bump = bench::MeasureBestNs(5, [&]
+    {
+        for (size_t frame = 0; frame < FrameCount; ++frame)
+        {
+            for (size_t i = 0; i < ScratchPerFrame; ++i)
+                TouchScratch(single.Allocate(ScratchSize(i), 16), i);
+            single.Reset();
+        }
+    });
+    PrintRow("serial FrameAllocator (bump pointer)", bump);
+
+    const double serialHeap = bench::MeasureBestNs(5, [&]
+    {
+        for (size_t frame = 0; frame < FrameCount; ++frame)
+        {
+            for (size_t i = 0; i < ScratchPerFrame; ++i)
+            {
+                uint8_t* p = new uint8_t[ScratchSize(i)];
+                TouchScratch(p, i);
+                delete[] p;
+            }
+        }
+    });
+    PrintRow("serial new[] / delete[]", serialHeap);
+
+    // 워커에서 시작한 ParallelFor: 메인 스레드는 돕지 않고 기다리므로 모든 할당이 워커 아레나 경로를 탄다
+    auto runOnWorker = [&pool](auto&& body)
+    {
+        std::atomic<bool> done{ false };
+        pool.Enqueue([&]
+        {
+            body();
+            done.store(true, std::memory_order_release);
+            done.notify_one();
+        });
+        done.wait(false, std::memory_order_acquire);
+    };
+
+    const double loopOnly = bench::MeasureBestNs(5, [&]
+    {
+        for (size_t frame = 0; frame < FrameCount; ++frame)
+        {
+            runOnWorker([&]
+            {
+                core::ParallelFor(pool, 0, ScratchPerFrame, 0, [&](size_t i) { bench::DoNotOptimize(i); });
+            });
+        }
+    });
+    PrintRow("ParallelFor on worker, no allocation", loopOnly);
+
+    core::WorkerFrameAllocator perWorker(pool, ArenaSize);
+    const double worker = bench::MeasureBestNs(5, [&]
+    {
+        for (size_t frame = 0; frame < FrameCount; ++frame)
+        {
+            runOnWorker([&]
+            {
+                core::ParallelFor(pool, 0, ScratchPerFrame, 0, [&](size_t i)
+                {
+                    TouchScratch(perWorker.Allocate(ScratchSize(i), 16), i);
+                });
+            });
+            perWorker.Reset();
+        }
+    });
+    PrintRow("ParallelFor on worker + WorkerFrameAllocator", worker);
+
+    // 메인 스레드에서 시작: 메인 스레드가 처리한 원소는 mutex 로 보호되는 공용 아레나를 쓴다
+    const double fromMain = bench::MeasureBestNs(5, [&]
+    {
+        for (size_t frame = 0; frame < FrameCount; ++frame)
+        {
+            core::ParallelFor(pool, 0, ScratchPerFrame, 0, [&](size_t i)
+            {
+                TouchScratch(perWorker.Allocate(ScratchSize(i), 16), i);
+            });
+            perWorker.Reset();
+        }
+    });
+    PrintRow("ParallelFor on main + WorkerFrameAllocator", fromMain);
+
+    const double heap = bench::MeasureBestNs(5, [&]
+    {
+        for (size_t frame = 0; frame < FrameCount; ++frame)
+        {
+            runOnWorker([&]
+            {
+                core::ParallelFor(pool, 0, ScratchPerFrame, 0, [&](size_t i)
+                {
+                    uint8_t* p = new uint8_t[ScratchSize(i)];
+                    TouchScratch(p, i);
+                    delete[] p;
+                });
+            });
+        }
+    });
+    PrintRow("ParallelFor on worker + new[] / delete[]", heap);
+
+    core::FrameAllocator shared(ArenaSize);
+    std::mutex sharedMutex;
+    const double locked = bench::MeasureBestNs(5, [&]
+    {
+        for (size_t frame = 0; frame < FrameCount; ++frame)
+        {
+            runOnWorker([&]
+            {
+                core::ParallelFor(pool, 0, ScratchPerFrame, 0, [&](size_t i)
+                {
+                    void* p;
+                    {
+                        std::lock_guard lock(sharedMutex);
+                        p = shared.Allocate(ScratchSize(i), 16);
+                    }
+                    TouchScratch(p, i);
+                });
+            });
+            shared.Reset();
+        }
+    });
+    PrintRow("ParallelFor on worker + shared arena + mutex", locked);
+}
+
+namespace
+{
+    constexpr size_t DrawFrameCount = 100;
+    constexpr size_t ObjectCount = 10000;
+
+    struct DrawItem
+    {
+        uint32_t mesh;
+        uint32_t material;
+        float    depth;
+        uint32_t instance;
+    };
+
+    // 업스트림 할당 횟수를 세는 memory_resource (힙 쪽 비교용)
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        size_t allocations = 0;
+
+    protected:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    // 한 프레임의 드로우 리스트 구성: 가시성 필터 -> 재질별 버킷 -> 정렬 키 생성 -> 정렬
+    // 크기를 미리 알 수 없는 일반적인 코드처럼 reserve 없이 push_back 한다
+    // 정렬은 두 방식이 같은 일을 하므로 sort 를 끄면 할당이 걸린 구성 단계만 비교할 수 있다
+    uint64_t BuildDrawList(std::pmr::memory_resource* resource, size_t frame, bool sort)
+    {
+        core::frame::vector<DrawItem> drawList(resource);
+        core::frame::unordered_map<uint32_t, uint32_t> perMaterial(resource);
+        core::frame::vector<uint64_t> sortKeys(resource);
+
+        for (size_t i = 0; i < ObjectCount; ++i)
+        {
+            if ((i * 2654435761u + frame) % 10 < 7)   // 약 70% 가 보임
+            {
+                const DrawItem item{ static_cast<uint32_t>(i % 512), static_cast<uint32_t>(i % 97),
+                                     static_cast<float>((i * 7919) % 1000) * 0.1f, static_cast<uint32_t>(i) };
+                drawList.push_back(item);
+                ++perMaterial[item.material];
+            }
+        }
+
+        for (size_t i = 0; i < drawList.size(); ++i)
+        {
+            const DrawItem& item = drawList[i];
+            const uint64_t depthBits = static_cast<uint64_t>(item.depth * 64.0f) & 0xFFFF;
+            sortKeys.push_back((static_cast<uint64_t>(item.material) << 48) | (depthBits << 32) | i);
+        }
+        if (sort)
+            std::sort(sortKeys.begin(), sortKeys.end());
+
+        return sortKeys.front() ^ sortKeys.back() ^ perMaterial.size();
+    }
+}
+
+// 드로우 리스트 / 정렬 키를 프레임 컨테이너(아레나)로 만들 때의 할당 절감
+CORE_BENCH(FrameContainersDrawList)
+{
+    std::printf("  %zu objects, ~70%% visible, %zu frames\n", ObjectCount, DrawFrameCount);
+
+    for (const bool sort : { false, true })
+    {
+        CountingResource heap;
+        const double heapNs = bench::MeasureBestNs(5, [&]
+        {
+            for (size_t frame = 0; frame < DrawFrameCount; ++frame)
+                bench::DoNotOptimize(BuildDrawList(&heap, frame, sort));
+        });
+
+        core::FrameAllocator arena(size_t{ 4 } << 20);
+        const double arenaNs = bench::MeasureBestNs(5, [&]
+        {
+            for (size_t frame = 0; frame < DrawFrameCount; ++frame)
+            {
+                bench::DoNotOptimize(BuildDrawList(&arena, frame, sort));
+                arena.Reset();
+            }
+        });
+
+        // 측정 5 회분의 누적이므로 회차 수로 나눈다
+        const double heapAllocsPerFrame = static_cast<double>(heap.allocations) / (5.0 * DrawFrameCount);
+        const char* phase = sort ? "build + sort" : "build";
+        std::printf("  %-13s std::pmr + new_delete      %8.1f us/frame  %5.0f heap allocations/frame\n",
+            phase, heapNs * 1e-3 / DrawFrameCount, heapAllocsPerFrame);
+        // Fixed 아레나는 생성 이후 힙을 쓰지 않는다 (core_test 의 FrameAllocatorCreateDoesNotAllocate)
+        std::printf("  %-13s frame containers + arena  %8.1f us/frame  %5d heap allocations/frame (arena peak %zu KB)\n",
+            phase, arenaNs * 1e-3 / DrawFrameCount, 0, arena.GetHighWaterMark() / 1024);
+    }
+}
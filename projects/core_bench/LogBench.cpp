@@ -0,0 +1,227 @@
+﻿#include <vector>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+
+#include <core/Log.hpp>
+#include <core/BinaryLog.hpp>
+
+#include "Bench.hpp"
+
+namespace
+{
+    constexpr int    LogThreadCount = 8;
+    constexpr size_t CallsPerThread = 20000;
+
+    std::string BenchLogPath()
+    {
+        return (std::filesystem::temp_directory_path() / "core_bench_log.log").string();
+    }
+
+    std::string BenchBinaryLogPath()
+    {
+        return (std::filesystem::temp_directory_path() / "core_bench_log.blog").string();
+    }
+
+    // threads 개의 스레드가 동시에 calls 번씩 로그를 남길 때 호출 하나의 지연 시간 분포
+    void RunLatency(const char* name, const core::LogConfig& config)
+    {
+        core::Log::Init(config);
+        const uint64_t droppedBefore = core::Log::GetDroppedCount();
+
+        std::vector<std::vector<uint64_t>> perThread(LogThreadCount);
+        std::atomic<int> ready{ 0 };
+        std::vector<std::thread> threads;
+        for (int t = 0; t < LogThreadCount; ++t)
+        {
+            threads.emplace_back([&, t]
+            {
+                std::vector<uint64_t>& samples = perThread[t];
+                samples.reserve(CallsPerThread);
+
+                ready.fetch_add(1);
+                while (ready.load() < LogThreadCount)
+                    std::this_thread::yield();
+
+                for (size_t i = 0; i < CallsPerThread; ++i)
+                {
+                    const auto start = bench::Clock::now();
+                    core::Log::Print(core::LogCategory::Core, spdlog::level::info, "frame {} entity {} pos ({:.2f}, {:.2f})", i, t, 1.5f, -2.25f);
+                    const auto end = bench::Clock::now();
+                    samples.push_back(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+                }
+            });
+        }
+        for (auto& th : threads)
+            th.join();
+
+        // 큐에 남은 메시지까지 기록되는 시간은 호출 지연에 넣지 않는다
+        const uint64_t dropped = core::Log::GetDroppedCount() - droppedBefore;
+        core::Log::Shutdown();
+
+        std::vector<uint64_t> all;
+        all.reserve(LogThreadCount * CallsPerThread);
+        for (auto& samples : perThread)
+            all.insert(all.end(), samples.begin(), samples.end());
+
+        const uint64_t p50 = bench::Percentile(all, 0.50);
+        const uint64_t p99 = bench::Percentile(all, 0.99);
+        const uint64_t p999 = bench::Percentile(all, 0.999);
+        std::printf("  %-24s p50 %7llu ns  p99 %9llu ns  p99.9 %9llu ns  max %9llu ns  dropped %llu\n", name,
+            static_cast<unsigned long long>(p50), static_cast<unsigned long long>(p99),
+            static_cast<unsigned long long>(p999), static_cast<unsigned long long>(all.back()),
+            static_cast<unsigned long long>(dropped));
+    }
+}
+
+// 8 스레드가 동시에 로그를 남길 때 호출 지연 (비동기 큐를 작게 잡아 넘침 정책이 자주 걸리게 한다)
+CORE_BENCH(LogCallLatency)
+{
+    std::printf("  %d threads x %zu calls, file sink only (%s)\n", LogThreadCount, CallsPerThread, BenchLogPath().c_str());
+
+    core::LogConfig config;
+    config.console = false;
+    config.filePath = BenchLogPath();
+
+    config.async = false;
+    RunLatency("sync", config);
+
+    config.async = true;
+    config.queueCapacity = 8192;
+    config.overflow = core::LogOverflowPolicy::Block;
+    RunLatency("async block (8192)", config);
+
+    config.queueCapacity = 256;
+    RunLatency("async block (256)", config);
+
+    config.overflow = core::LogOverflowPolicy::DropOldest;
+    RunLatency("async drop-oldest (256)", config);
+
+    config.overflow = core::LogOverflowPolicy::DropNew;
+    RunLatency("async drop-new (256)", config);
+
+    std::filesystem::remove(BenchLogPath());
+}
+
+// 꺼진 수준의 로그 호출 비용 (빈 루프 대비 호출 하나당 추가 ns)
+CORE_BENCH(LogDisabledCall)
+{
+    constexpr size_t Calls = 10'000'000;
+
+    core::LogConfig config;
+    config.console = false;
+    config.filePath = BenchLogPath();
+    core::Log::Init(config);
+    core::Log::SetLevel(core::LogCategory::Core, spdlog::level::warn);
+
+    float x = 1.5f;
+    const double baseline = bench::MeasureBestNs(5, [&]
+    {
+        for (size_t i = 0; i < Calls; ++i)
+        {
+            bench::DoNotOptimize(i);
+            bench::DoNotOptimize(x);
+        }
+    });
+
+    auto row = [&](const char* name, double ns)
+    {
+        std::printf("  %-36s %6.2f ns/call\n", name, (std::max)(0.0, ns - baseline) / Calls);
+    };
+
+    std::printf("  %zu calls, empty loop %.2f ns/iteration\n", Calls, baseline / Calls);
+
+    row("LogInfo (runtime off)", bench::MeasureBestNs(5, [&]
+    {
+        for (size_t i = 0; i < Calls; ++i)
+        {
+            bench::DoNotOptimize(i);
+            bench::DoNotOptimize(x);
+            core::LogInfo("frame {} pos {}", i, x);
+        }
+    }));
+
+    row("CORE_LOG_INFO (runtime off)", bench::MeasureBestNs(5, [&]
+    {
+        for (size_t i = 0; i < Calls; ++i)
+        {
+            bench::DoNotOptimize(i);
+            bench::DoNotOptimize(x);
+            CORE_LOG_INFO(Core, "frame {} pos {}", i, x);
+        }
+    }));
+
+    // 릴리스(CORE_LOG_MIN_LEVEL = info)에서는 컴파일 시점에 사라진다
+    row("LogDebug (compiled out in release)", bench::MeasureBestNs(5, [&]
+    {
+        for (size_t i = 0; i < Calls; ++i)
+        {
+            bench::DoNotOptimize(i);
+            bench::DoNotOptimize(x);
+            core::LogDebug("frame {} pos {}", i, x);
+        }
+    }));
+
+    core::Log::Shutdown();
+    std::filesystem::remove(BenchLogPath());
+}
+
+// 바이너리 로그 호출 하나의 비용 (호출 스레드 쪽만. 포맷/파일 기록은 writer 스레드)
+CORE_BENCH(BinaryLogCall)
+{
+    constexpr size_t Calls = 50'000;
+
+    core::LogConfig logConfig;
+    logConfig.console = false;
+    logConfig.filePath = BenchLogPath();
+    core::Log::Init(logConfig);
+
+    // 한 회차 분량이 다 들어가는 버퍼 (레코드 하나 64 바이트 이하) 라 측정 중에는 버려지지 않는다
+    core::BinaryLogConfig config;
+    config.filePath = BenchBinaryLogPath();
+    config.bufferSize = 4 << 20;
+    config.pollInterval = std::chrono::milliseconds(1);
+    core::BinaryLog::Init(config);
+
+    const uint64_t droppedBefore = core::BinaryLog::GetDroppedCount();
+    const char* name = "player";
+    float x = 1.5f;
+
+    // 회차 사이에 writer 가 버퍼를 비우도록 쉬고, 가장 빠른 회차를 쓴다
+    auto measure = [&](const char* label, auto&& body)
+    {
+        double best = 1e300;
+        for (int r = 0; r < 10; ++r)
+        {
+            best = (std::min)(best, bench::MeasureBestNs(1, body));
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        std::printf("  %-44s %6.1f ns/call\n", label, best / Calls);
+    };
+
+    // 호출 위치 등록과 스레드 버퍼 생성은 첫 호출에서만 일어나므로 측정에서 뺀다
+    auto mixed = [&]
+    {
+        for (size_t i = 0; i < Calls; ++i)
+        {
+            bench::DoNotOptimize(x);
+            CORE_BLOG_INFO(Core, "frame {} {} pos {:.2f}", i, name, x);
+        }
+    };
+    auto ints = [&]
+    {
+        for (size_t i = 0; i < Calls; ++i)
+            CORE_BLOG_INFO(Core, "{} {} {}", i, i + 1, i + 2);
+    };
+    CORE_BLOG_INFO(Core, "warm up {}", 0);
+
+    measure("CORE_BLOG_INFO (size_t, const char*, float)", mixed);
+    measure("CORE_BLOG_INFO (3 x size_t)", ints);
+    std::printf("  dropped %llu\n", static_cast<unsigned long long>(core::BinaryLog::GetDroppedCount() - droppedBefore));
+
+    core::BinaryLog::Shutdown();
+    core::Log::Shutdown();
+    std::filesystem::remove(BenchBinaryLogPath());
+    std::filesystem::remove(BenchLogPath());
+}
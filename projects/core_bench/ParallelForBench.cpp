@@ -0,0 +1,135 @@
+﻿#include <vector>
+#include <thread>
+#include <algorithm>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <core/ParallelFor.hpp>
+
+#include "Bench.hpp"
+
+namespace
+{
+    constexpr size_t ElementCount = 1000000;
+
+    struct BenchTransform
+    {
+        glm::vec3 position;
+        glm::quat rotation;
+        glm::vec3 scale;
+    };
+
+    struct Aabb
+    {
+        glm::vec3 min;
+        glm::vec3 max;
+    };
+
+    glm::mat4 ToWorld(const BenchTransform& t)
+    {
+        return glm::scale(glm::translate(glm::mat4(1.0f), t.position) * glm::mat4_cast(t.rotation), t.scale);
+    }
+
+    // 로컬 AABB 를 월드 행렬로 옮긴 AABB (Arvo 방식)
+    Aabb TransformAabb(const Aabb& box, const glm::mat4& m)
+    {
+        Aabb out{ glm::vec3(m[3]), glm::vec3(m[3]) };
+        for (int c = 0; c < 3; ++c)
+        {
+            const glm::vec3 a = glm::vec3(m[c]) * box.min[c];
+            const glm::vec3 b = glm::vec3(m[c]) * box.max[c];
+            out.min += glm::min(a, b);
+            out.max += glm::max(a, b);
+        }
+        return out;
+    }
+
+    Aabb Merge(Aabb a, const Aabb& b)
+    {
+        return Aabb{ glm::min(a.min, b.min), glm::max(a.max, b.max) };
+    }
+
+    void PrintRow(const char* name, double ns)
+    {
+        std::printf("  %-34s %8.2f ms  %6.2f ns/element\n", name, ns * 1e-6, ns / static_cast<double>(ElementCount));
+    }
+}
+
+// 1M 원소 트랜스폼 / AABB 배열에 대한 ParallelFor / ParallelReduce 원소당 비용
+CORE_BENCH(ParallelForTransforms)
+{
+    std::vector<BenchTransform> transforms(ElementCount);
+    std::vector<Aabb> localBounds(ElementCount);
+    for (size_t i = 0; i < ElementCount; ++i)
+    {
+        const float f = static_cast<float>(i);
+        transforms[i] = { glm::vec3(f, f * 0.5f, -f), glm::angleAxis(f * 0.001f, glm::vec3(0.0f, 1.0f, 0.0f)), glm::vec3(1.0f + (i % 3)) };
+        localBounds[i] = { glm::vec3(-1.0f), glm::vec3(1.0f + (i % 5)) };
+    }
+    std::vector<glm::mat4> world(ElementCount);
+
+    core::ThreadPool pool;
+    std::printf("  workers: %zu (hardware threads: %u)\n", pool.GetWorkerCount(), std::thread::hardware_concurrency());
+
+    // 트랜스폼 -> 월드 행렬
+    const double serial = bench::MeasureBestNs(5, [&]
+    {
+        for (size_t i = 0; i < ElementCount; ++i)
+            world[i] = ToWorld(transforms[i]);
+    });
+    PrintRow("transform/serial", serial);
+
+    const double perElement = bench::MeasureBestNs(5, [&]
+    {
+        core::ParallelFor(pool, 0, ElementCount, 0, [&](size_t i) { world[i] = ToWorld(transforms[i]); });
+    });
+    PrintRow("transform/ParallelFor(index)", perElement);
+
+    const double perChunk = bench::MeasureBestNs(5, [&]
+    {
+        core::ParallelFor(pool, core::IndexRange{ 0, ElementCount }, 0, [&](core::IndexRange chunk)
+        {
+            for (size_t i = chunk.begin; i < chunk.end; ++i)
+                world[i] = ToWorld(transforms[i]);
+        });
+    });
+    PrintRow("transform/ParallelFor(chunk)", perChunk);
+
+    // 비교: 원소마다 작업 하나를 Enqueue 하던 방식
+    const double perJob = bench::MeasureBestNs(1, [&]
+    {
+        core::JobCounter counter;
+        for (size_t i = 0; i < ElementCount; ++i)
+            pool.Enqueue([&world, &transforms, i] { world[i] = ToWorld(transforms[i]); }, &counter);
+        pool.Wait(counter);
+    });
+    PrintRow("transform/Enqueue per element", perJob);
+
+    std::printf("  ParallelFor overhead over serial: %.2f ns/element\n", (perElement - serial) / static_cast<double>(ElementCount));
+
+    // 월드 AABB 를 만들어 전체 경계로 리듀스
+    Aabb serialBounds{};
+    const double reduceSerial = bench::MeasureBestNs(5, [&]
+    {
+        Aabb acc{ glm::vec3(1e30f), glm::vec3(-1e30f) };
+        for (size_t i = 0; i < ElementCount; ++i)
+            acc = Merge(acc, TransformAabb(localBounds[i], world[i]));
+        serialBounds = acc;
+    });
+    PrintRow("aabb/serial", reduceSerial);
+
+    Aabb parallelBounds{};
+    const double reduceParallel = bench::MeasureBestNs(5, [&]
+    {
+        parallelBounds = core::ParallelReduce(pool, core::IndexRange{ 0, ElementCount }, 0, Aabb{ glm::vec3(1e30f), glm::vec3(-1e30f) },
+            [&](size_t i) { return TransformAabb(localBounds[i], world[i]); },
+            [](Aabb a, const Aabb& b) { return Merge(a, b); });
+    });
+    PrintRow("aabb/ParallelReduce(index)", reduceParallel);
+
+    std::printf("  ParallelReduce overhead over serial: %.2f ns/element (bounds match: %s)\n",
+        (reduceParallel - reduceSerial) / static_cast<double>(ElementCount),
+        serialBounds.min == parallelBounds.min && serialBounds.max == parallelBounds.max ? "yes" : "no");
+}
@@ -0,0 +1,130 @@
+﻿#include <vector>
+#include <atomic>
+#include <cstdint>
+
+#include <core/Task.hpp>
+
+#include "Bench.hpp"
+
+namespace
+{
+    constexpr size_t ChainCount = 20000;
+    constexpr int StageCount = 4;   // load -> decode -> upload -> register
+
+    inline uint64_t Stage(uint64_t v)
+    {
+        return v * 6364136223846793005ull + 1442695040888963407ull;
+    }
+
+    // 코루틴: 단계마다 풀로 이동
+    core::Task<uint64_t> CoroutineChain(core::ThreadPool& pool, uint64_t seed)
+    {
+        uint64_t v = seed;
+        for (int s = 0; s < StageCount; ++s)
+        {
+            co_await core::Schedule(pool);
+            v = Stage(v);
+        }
+        co_return v;
+    }
+
+    // 같은 흐름을 Future::Then 콜백으로
+    core::Future<uint64_t> FutureChain(core::ThreadPool& pool, uint64_t seed)
+    {
+        return pool.Submit([seed] { return Stage(seed); })
+            .Then([](uint64_t& v) { return Stage(v); })
+            .Then([](uint64_t& v) { return Stage(v); })
+            .Then([](uint64_t& v) { return Stage(v); });
+    }
+
+    // 같은 흐름을 Job 이 다음 Job 을 넣는 콜백으로 (결과 전달 수단 없음, 하한선)
+    struct CallbackChain
+    {
+        static void Run(core::ThreadPool& pool, core::JobCounter& counter, std::atomic<uint64_t>& sink, uint64_t v, int stage)
+        {
+            v = Stage(v);
+            if (stage + 1 == StageCount)
+            {
+                sink.fetch_add(v, std::memory_order_relaxed);
+                return;
+            }
+            pool.Enqueue([&pool, &counter, &sink, v, stage] { Run(pool, counter, sink, v, stage + 1); }, &counter);
+        }
+    };
+
+    // 풀 이동 없이 Task 를 Task 안에서 co_await (대칭 전환만)
+    core::Task<uint64_t> InlineStage(uint64_t v)
+    {
+        co_return Stage(v);
+    }
+
+    core::Task<uint64_t> InlineChain(uint64_t seed)
+    {
+        uint64_t v = seed;
+        for (int s = 0; s < StageCount; ++s)
+            v = co_await InlineStage(v);
+        co_return v;
+    }
+
+    core::Task<uint64_t> InlineChains(size_t count)
+    {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < count; ++i)
+            sum += co_await InlineChain(i);
+        co_return sum;
+    }
+
+    void PrintRow(const char* name, double ns)
+    {
+        std::printf("  %-30s %8.1f ns/chain  %7.1f ns/stage\n",
+            name, ns / ChainCount, ns / (ChainCount * StageCount));
+    }
+}
+
+// 4 단계 비동기 흐름을 코루틴 체인과 콜백 체인으로 만들었을 때의 비용
+CORE_BENCH(TaskVsCallbackChains)
+{
+    core::ThreadPool pool;
+    std::printf("  workers: %zu, %zu chains x %d stages\n", pool.GetWorkerCount(), ChainCount, StageCount);
+
+    std::vector<core::Future<uint64_t>> futures;
+    futures.reserve(ChainCount);
+
+    const double coroutine = bench::MeasureBestNs(3, [&]
+    {
+        futures.clear();
+        for (size_t i = 0; i < ChainCount; ++i)
+            futures.push_back(core::Spawn(pool, CoroutineChain(pool, i)));
+        for (auto& f : futures)
+            bench::DoNotOptimize(f.Get());
+    });
+    PrintRow("coroutine (Spawn + Schedule)", coroutine);
+
+    const double thenChain = bench::MeasureBestNs(3, [&]
+    {
+        futures.clear();
+        for (size_t i = 0; i < ChainCount; ++i)
+            futures.push_back(FutureChain(pool, i));
+        for (auto& f : futures)
+            bench::DoNotOptimize(f.Get());
+    });
+    PrintRow("callback (Submit + Then)", thenChain);
+
+    const double rawCallback = bench::MeasureBestNs(3, [&]
+    {
+        core::JobCounter counter;
+        std::atomic<uint64_t> sink{ 0 };
+        for (size_t i = 0; i < ChainCount; ++i)
+            pool.Enqueue([&pool, &counter, &sink, i] { CallbackChain::Run(pool, counter, sink, i, 0); }, &counter);
+        pool.Wait(counter);
+        bench::DoNotOptimize(sink.load());
+    });
+    PrintRow("callback (Job -> Job)", rawCallback);
+
+    // 워커 하나에서 모든 체인을 연달아 실행 (코루틴 프레임 할당 + 대칭 전환 비용)
+    const double inlineAwait = bench::MeasureBestNs(3, [&]
+    {
+        bench::DoNotOptimize(core::SyncWait(pool, InlineChains(ChainCount)));
+    });
+    PrintRow("co_await Task (no pool hop)", inlineAwait);
+}
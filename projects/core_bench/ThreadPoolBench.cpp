@@ -0,0 +1,150 @@
+﻿#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+#include <core/ThreadPool.hpp>
+
+#include "Bench.hpp"
+
+namespace
+{
+    // 비교 기준: 작업 훔치기 도입 전의 ThreadPool (공유 deque 하나 + mutex + condition_variable)
+    class LockedDequePool
+    {
+    public:
+        explicit LockedDequePool(size_t numThreads)
+        {
+            for (size_t i = 0; i < numThreads; ++i)
+                _workers.emplace_back([this] { workerLoop(); });
+        }
+
+        ~LockedDequePool()
+        {
+            {
+                std::lock_guard<std::mutex> lk(_queueMutex);
+                _stopping = true;
+            }
+            _queueCv.notify_all();
+            for (auto& t : _workers)
+                t.join();
+        }
+
+        void Enqueue(std::function<void()> job)
+        {
+            {
+                std::lock_guard<std::mutex> lk(_queueMutex);
+                _jobQueue.push_back(std::move(job));
+                ++_pendingJobs;
+            }
+            _queueCv.notify_one();
+        }
+
+        void WaitAll() const
+        {
+            while (_pendingJobs.load() > 0)
+                std::this_thread::yield();
+        }
+
+    private:
+        void workerLoop()
+        {
+            for (;;)
+            {
+                std::function<void()> job;
+                {
+                    std::unique_lock<std::mutex> lk(_queueMutex);
+                    _queueCv.wait(lk, [this] { return _stopping || !_jobQueue.empty(); });
+                    if (_stopping && _jobQueue.empty())
+                        return;
+                    job = std::move(_jobQueue.front());
+                    _jobQueue.pop_front();
+                }
+                job();
+                --_pendingJobs;
+            }
+        }
+
+        std::vector<std::thread>          _workers;
+        std::deque<std::function<void()>> _jobQueue;
+        std::mutex                        _queueMutex;
+        std::condition_variable           _queueCv;
+        bool                              _stopping = false;
+        std::atomic<int>                  _pendingJobs{ 0 };
+    };
+
+    constexpr size_t FlatJobs = 100000;
+    constexpr size_t NestedRoots = 256;
+    constexpr size_t NestedChildren = 256;
+    constexpr size_t ThreadCounts[] = { 1, 4, 16, 64 };
+
+    // 작업 하나의 실제 일은 아주 작게 두어 큐 경합이 지배하도록 한다
+    inline void TinyWork(std::atomic<uint64_t>& sink, uint64_t seed)
+    {
+        uint64_t x = seed;
+        for (int i = 0; i < 16; ++i)
+            x = x * 6364136223846793005ull + 1442695040888963407ull;
+        sink.fetch_add(x & 1, std::memory_order_relaxed);
+    }
+
+    // 메인 스레드 하나가 작은 작업을 대량으로 넣는다
+    template<typename Pool>
+    double RunFlat(Pool& pool)
+    {
+        std::atomic<uint64_t> sink{ 0 };
+        return bench::MeasureBestNs(3, [&]
+        {
+            for (size_t i = 0; i < FlatJobs; ++i)
+                pool.Enqueue([&sink, i] { TinyWork(sink, i); });
+            pool.WaitAll();
+        });
+    }
+
+    // 워커가 실행 중에 자식 작업을 넣는다 (fork-join 형태, 작업 훔치기가 가장 유리한 경우)
+    template<typename Pool>
+    double RunNested(Pool& pool)
+    {
+        std::atomic<uint64_t> sink{ 0 };
+        return bench::MeasureBestNs(3, [&]
+        {
+            for (size_t r = 0; r < NestedRoots; ++r)
+            {
+                pool.Enqueue([&pool, &sink, r]
+                {
+                    for (size_t c = 0; c < NestedChildren; ++c)
+                        pool.Enqueue([&sink, r, c] { TinyWork(sink, r * NestedChildren + c); });
+                });
+            }
+            pool.WaitAll();
+        });
+    }
+
+    void PrintRow(const char* name, size_t threads, size_t jobs, double ns)
+    {
+        std::printf("  %-22s threads=%-3zu %8.1f ns/job  %7.2f Mjobs/s\n",
+            name, threads, ns / static_cast<double>(jobs), static_cast<double>(jobs) * 1e3 / ns);
+    }
+}
+
+// 공유 deque + mutex 풀과 작업 훔치기 풀의 처리량 비교 (1/4/16/64 스레드)
+CORE_BENCH(ThreadPoolContention)
+{
+    std::printf("  hardware threads: %u\n", std::thread::hardware_concurrency());
+
+    for (size_t threads : ThreadCounts)
+    {
+        {
+            LockedDequePool pool(threads);
+            PrintRow("flat/locked-deque", threads, FlatJobs, RunFlat(pool));
+            PrintRow("nested/locked-deque", threads, NestedRoots * (NestedChildren + 1), RunNested(pool));
+        }
+        {
+            core::ThreadPool pool(threads);
+            PrintRow("flat/work-stealing", threads, FlatJobs, RunFlat(pool));
+            PrintRow("nested/work-stealing", threads, NestedRoots * (NestedChildren + 1), RunNested(pool));
+        }
+    }
+}
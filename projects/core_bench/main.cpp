@@ -0,0 +1,23 @@
+﻿#include <cstdio>
+#include <string_view>
+
+#include "Bench.hpp"
+
+// 사용법: core_bench [이름 일부]
+// 인자가 없으면 등록된 벤치마크를 모두 실행한다
+int main(int argc, char** argv)
+{
+    const std::string_view filter = argc > 1 ? argv[1] : "";
+
+    for (const bench::BenchCase& bc : bench::GetRegistry())
+    {
+        if (!filter.empty() && std::string_view(bc.name).find(filter) == std::string_view::npos)
+            continue;
+
+        std::printf("== %s ==\n", bc.name);
+        bc.fn();
+        std::printf("\n");
+        std::fflush(stdout);
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+﻿#include <new>
+#include <atomic>
+#include <cstdlib>
+
+#include "AllocationCounter.hpp"
+
+namespace
+{
+    std::atomic<size_t> s_AllocationCount{ 0 };
+
+    void* CountedAlloc(size_t size, size_t alignment) noexcept
+    {
+        s_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        if (size == 0) size = 1;
+        if (alignment <= alignof(std::max_align_t))
+            return std::malloc(size);
+
+        // aligned_alloc 은 크기가 정렬의 배수여야 한다
+        size = (size + alignment - 1) & ~(alignment - 1);
+#if defined(_MSC_VER)
+        return _aligned_malloc(size, alignment);
+#else
+        return std::aligned_alloc(alignment, size);
+#endif
+    }
+
+    void* CountedNew(size_t size, size_t alignment)
+    {
+        for (;;)
+        {
+            if (void* p = CountedAlloc(size, alignment))
+                return p;
+
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) throw std::bad_alloc();
+            handler();
+        }
+    }
+
+    void CountedFree(void* p, size_t alignment) noexcept
+    {
+#if defined(_MSC_VER)
+        if (alignment > alignof(std::max_align_t)) { _aligned_free(p); return; }
+#else
+        (void)alignment;
+#endif
+        std::free(p);
+    }
+}
+
+namespace test
+{
+    size_t GetAllocationCount()
+    {
+        return s_AllocationCount.load(std::memory_order_relaxed);
+    }
+}
+
+void* operator new(size_t size) { return CountedNew(size, 0); }
+void* operator new[](size_t size) { return CountedNew(size, 0); }
+void* operator new(size_t size, std::align_val_t al) { return CountedNew(size, static_cast<size_t>(al)); }
+void* operator new[](size_t size, std::align_val_t al) { return CountedNew(size, static_cast<size_t>(al)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return CountedAlloc(size, 0); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return CountedAlloc(size, 0); }
+void* operator new(size_t size, std::align_val_t al, const std::nothrow_t&) noexcept { return CountedAlloc(size, static_cast<size_t>(al)); }
+void* operator new[](size_t size, std::align_val_t al, const std::nothrow_t&) noexcept { return CountedAlloc(size, static_cast<size_t>(al)); }
+
+void operator delete(void* p) noexcept { CountedFree(p, 0); }
+void operator delete[](void* p) noexcept { CountedFree(p, 0); }
+void operator delete(void* p, size_t) noexcept { CountedFree(p, 0); }
+void operator delete[](void* p, size_t) noexcept { CountedFree(p, 0); }
+void operator delete(void* p, std::align_val_t al) noexcept { CountedFree(p, static_cast<size_t>(al)); }
+void operator delete[](void* p, std::align_val_t al) noexcept { CountedFree(p, static_cast<size_t>(al)); }
+void operator delete(void* p, size_t, std::align_val_t al) noexcept { CountedFree(p, static_cast<size_t>(al)); }
+void operator delete[](void* p, size_t, std::align_val_t al) noexcept { CountedFree(p, static_cast<size_t>(al)); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { CountedFree(p, 0); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { CountedFree(p, 0); }
+void operator delete(void* p, std::align_val_t al, const std::nothrow_t&) noexcept { CountedFree(p, static_cast<size_t>(al)); }
+void operator delete[](void* p, std::align_val_t al, const std::nothrow_t&) noexcept { CountedFree(p, static_cast<size_t>(al)); }
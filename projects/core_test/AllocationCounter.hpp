@@ -0,0 +1,21 @@
+﻿#pragma once
+#include <cstddef>
+
+// 전역 operator new 호출 횟수 계측 (정의는 AllocationCounter.cpp, 프로그램 전체의 operator new 를 교체한다)
+// 모든 스레드의 할당을 센다. 워커 스레드에서 실행되는 작업의 할당도 잡기 위함
+namespace test
+{
+    size_t GetAllocationCount();
+
+    // 생성 이후 일어난 operator new 호출 수
+    class AllocationScope
+    {
+    public:
+        AllocationScope() : _start(GetAllocationCount()) {}
+
+        size_t GetCount() const { return GetAllocationCount() - _start; }
+
+    private:
+        size_t _start;
+    };
+}
@@ -0,0 +1,61 @@
+﻿#include <string>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+
+#include <core/BinaryLog.hpp>
+
+#include "Test.hpp"
+
+namespace
+{
+    std::string TestBinaryLogPath()
+    {
+        return (std::filesystem::temp_directory_path() / "core_test_binary.blog").string();
+    }
+
+    struct DecodedRecord
+    {
+        int64_t     timestamp;
+        std::string text;
+    };
+
+    std::vector<DecodedRecord> DecodeAll(const std::string& path)
+    {
+        std::vector<DecodedRecord> records;
+        std::ifstream in(path, std::ios::binary);
+        core::BinaryLogReader::Read(in, [&](const core::BinaryLogEntry& entry)
+        {
+            records.push_back({ entry.timestamp, std::string(entry.text) });
+        });
+        return records;
+    }
+}
+
+// null const char* 는 "(null)" 로 기록되고, 파일의 시각은 호출 전후의 system_clock 사이에 있다
+CORE_TEST(BinaryLogNullStringAndTimestamp)
+{
+    core::BinaryLogConfig config;
+    config.filePath = TestBinaryLogPath();
+    CORE_CHECK(core::BinaryLog::Init(config));
+    core::Log::SetLevel(core::LogCategory::Core, spdlog::level::info);
+
+    const char* missing = nullptr;
+    const int64_t before = core::internal::ReadBinaryLogSystemNs();
+    CORE_BLOG_INFO(Core, "name {} id {}", missing, 7);
+    const int64_t after = core::internal::ReadBinaryLogSystemNs();
+
+    core::BinaryLog::Shutdown();
+    core::Log::SetLevel(core::LogCategory::Core, spdlog::level::off);
+
+    const std::vector<DecodedRecord> records = DecodeAll(config.filePath);
+    CORE_CHECK(records.size() == 1);
+    if (records.size() == 1)
+    {
+        CORE_CHECK(records[0].text == "name (null) id 7");
+        // 틱 -> ns 보간 오차 (두 시계를 읽는 사이의 간격) 를 조금 허용
+        constexpr int64_t slack = 1'000'000;
+        CORE_CHECK(records[0].timestamp >= before - slack && records[0].timestamp <= after + slack);
+    }
+    std::filesystem::remove(config.filePath);
+}
@@ -0,0 +1,39 @@
+﻿#include <thread>
+
+#include <core/CpuTopology.hpp>
+
+#if defined(__linux__)
+    #include <sched.h>
+#endif
+
+#include "Test.hpp"
+
+// 토폴로지에는 프로세스가 실제로 쓸 수 있는 논리 프로세서만 들어 있어야 한다
+CORE_TEST(CpuTopologyRespectsProcessAffinity)
+{
+    const core::CpuTopology& topology = core::CpuTopology::Get();
+    CORE_CHECK(topology.GetPhysicalCoreCount() > 0);
+    CORE_CHECK(topology.GetLogicalProcessorCount() >= topology.GetPhysicalCoreCount());
+
+#if defined(__linux__)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0)
+    {
+        CORE_CHECK(topology.GetLogicalProcessorCount() <= static_cast<size_t>(CPU_COUNT(&allowed)));
+        for (const core::PhysicalCore& core : topology.GetPhysicalCores())
+        {
+            for (uint32_t cpu : core.logicalProcessors)
+                CORE_CHECK(cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed));
+        }
+    }
+#endif
+
+    // 워커 고정이 실패하지 않는지 (affinity 밖의 CPU 가 섞여 있으면 실패한다)
+    // 이후 생성되는 스레드가 affinity 를 물려받지 않도록 별도 스레드에서 확인
+    std::thread([&topology]
+    {
+        for (const core::PhysicalCore& core : topology.GetPhysicalCores())
+            CORE_CHECK(core::SetCurrentThreadAffinity(core.logicalProcessors));
+    }).join();
+}
@@ -0,0 +1,235 @@
+﻿#include <array>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#include <core/FrameAllocator.hpp>
+
+#include "AllocationCounter.hpp"
+#include "Test.hpp"
+
+namespace
+{
+    // 소멸 순서를 기록하는 non-trivial 타입 (기록 버퍼는 미리 잡아 둔다)
+    struct Tracked
+    {
+        static inline std::array<int, 64> s_Order{};
+        static inline size_t s_Count = 0;
+
+        int id;
+        explicit Tracked(int i) : id(i) {}
+        ~Tracked() { s_Order[s_Count++ % s_Order.size()] = id; }
+    };
+
+    struct Trivial
+    {
+        float x, y, z;
+    };
+}
+
+// Create<T> 의 소멸자 항목은 아레나 안의 침습 리스트이므로, 생성 이후에는 힙 할당이 없다
+CORE_TEST(FrameAllocatorCreateDoesNotAllocate)
+{
+    core::FrameAllocator allocator(64 * 1024);
+
+    test::AllocationScope scope;
+    for (int frame = 0; frame < 100; ++frame)
+    {
+        for (int i = 0; i < 32; ++i)
+        {
+            allocator.Create<Tracked>(i);
+            allocator.Create<Trivial>(Trivial{ 1.0f, 2.0f, 3.0f });
+        }
+        allocator.Allocate(256, 64);
+        allocator.Reset();
+    }
+    CORE_CHECK(scope.GetCount() == 0);
+}
+
+// Reset / RollbackTo 는 생성의 역순으로 소멸자를 실행한다
+CORE_TEST(FrameAllocatorDestroysInReverseOrder)
+{
+    core::FrameAllocator allocator(16 * 1024);
+
+    Tracked::s_Count = 0;
+    for (int i = 0; i < 4; ++i)
+        allocator.Create<Tracked>(i);
+
+    const core::FrameAllocator::Marker marker = allocator.GetMarker();
+    allocator.Create<Tracked>(10);
+    allocator.Create<Tracked>(11);
+
+    allocator.RollbackTo(marker);
+    CORE_CHECK(Tracked::s_Count == 2);
+    CORE_CHECK(Tracked::s_Order[0] == 11 && Tracked::s_Order[1] == 10);
+
+    allocator.Reset();
+    CORE_CHECK(Tracked::s_Count == 6);
+    CORE_CHECK(Tracked::s_Order[2] == 3 && Tracked::s_Order[3] == 2 && Tracked::s_Order[4] == 1 && Tracked::s_Order[5] == 0);
+}
+
+// 중첩된 ScopedArena 는 안쪽부터 자기 스코프에서 생성한 것만 역순으로 소멸시키고, 바깥 객체와 메모리는 건드리지 않는다
+CORE_TEST(ScopedArenaNestedRollback)
+{
+    core::FrameAllocator allocator(16 * 1024);
+
+    Tracked::s_Count = 0;
+    Tracked* outer = allocator.Create<Tracked>(1);
+    const size_t usedBefore = allocator.GetUsedSize();
+    {
+        core::ScopedArena scope(allocator);
+        scope.Create<Tracked>(2);
+        scope.Create<Tracked>(3);
+        {
+            core::ScopedArena inner(allocator);
+            inner.Create<Tracked>(4);
+            inner.Allocate(512);
+            inner.Create<Tracked>(5);
+        }
+        CORE_CHECK(Tracked::s_Count == 2);
+        CORE_CHECK(Tracked::s_Order[0] == 5 && Tracked::s_Order[1] == 4);
+
+        // 안쪽 스코프가 되감은 자리를 다시 쓴다
+        scope.Create<Tracked>(6);
+    }
+    CORE_CHECK(Tracked::s_Count == 5);
+    CORE_CHECK(Tracked::s_Order[2] == 6 && Tracked::s_Order[3] == 3 && Tracked::s_Order[4] == 2);
+    CORE_CHECK(allocator.GetUsedSize() == usedBefore);
+    CORE_CHECK(outer->id == 1);
+
+    allocator.Reset();
+    CORE_CHECK(Tracked::s_Count == 6 && Tracked::s_Order[5] == 1);
+}
+
+// Chained 는 넘칠 때 청크를 붙여 이전 할당을 옮기지 않고, 다음 Reset 에서 high-water mark 이상의 단일 블록으로 합친다
+CORE_TEST(FrameAllocatorChainedGrowsAndCoalesces)
+{
+    core::FrameAllocator allocator(4 * 1024, core::FrameAllocatorGrowth::Chained);
+
+    std::vector<unsigned char*> blocks;
+    for (int i = 0; i < 24; ++i)
+    {
+        auto* block = static_cast<unsigned char*>(allocator.Allocate(1024));
+        std::memset(block, i, 1024);
+        blocks.push_back(block);
+    }
+    CORE_CHECK(allocator.GetChunkCount() > 1);
+    CORE_CHECK(allocator.GetUsedSize() >= 24 * 1024);
+    CORE_CHECK(allocator.GetCapacity() >= allocator.GetUsedSize());
+
+    bool intact = true;
+    for (int i = 0; i < 24; ++i)
+        intact &= blocks[i][0] == i && blocks[i][1023] == i;
+    CORE_CHECK(intact);
+
+    const size_t highWater = allocator.GetHighWaterMark();
+    allocator.Reset();
+    CORE_CHECK(allocator.GetChunkCount() == 1);
+    CORE_CHECK(allocator.GetUsedSize() == 0);
+    CORE_CHECK(allocator.GetCapacity() >= highWater);
+
+    // 같은 부하의 다음 프레임은 청크 없이 단일 블록에 들어간다
+    for (int i = 0; i < 24; ++i)
+        allocator.Allocate(1024);
+    CORE_CHECK(allocator.GetChunkCount() == 1);
+    allocator.Reset();
+
+    // Fixed 는 넘치면 std::bad_alloc
+    core::FrameAllocator fixed(4 * 1024);
+    bool threw = false;
+    try
+    {
+        fixed.Allocate(8 * 1024);
+    }
+    catch (const std::bad_alloc&)
+    {
+        threw = true;
+    }
+    CORE_CHECK(threw);
+}
+
+// Reserved 트림은 프레임 끝 사용량이 아니라 프레임 중 최대 사용량(ScopedArena 로 되감은 양 포함)을 기준으로 한다
+CORE_TEST(FrameAllocatorTrimKeepsFramePeak)
+{
+    core::FrameAllocatorDesc desc;
+    desc.size = 64 << 20;
+    desc.growth = core::FrameAllocatorGrowth::Reserved;
+    desc.minCommit = 64 << 10;
+    desc.trimInterval = 2;
+    core::FrameAllocator allocator(desc);
+
+    constexpr size_t spike = 1 << 20;
+    for (int frame = 0; frame < 4; ++frame)
+    {
+        allocator.Allocate(1024);
+        {
+            core::ScopedArena scratch(allocator);
+            scratch.Allocate(spike);
+        }
+        allocator.Allocate(1024);
+        CORE_CHECK(allocator.GetFramePeak() >= spike);
+        allocator.Reset();
+        CORE_CHECK(allocator.GetFramePeak() == 0);
+    }
+    CORE_CHECK(allocator.GetCapacity() >= spike);
+}
+
+// MemoryTracker 의 arenaHighWater 는 프레임 중 최대 사용량을 반영한다
+CORE_TEST(FrameAllocatorReportsFramePeakToTracker)
+{
+    core::FrameAllocatorDesc desc;
+    desc.size = 4 << 20;
+    desc.growth = core::FrameAllocatorGrowth::Chained;
+    desc.tag = core::MemoryTag::Game;
+    core::FrameAllocator allocator(desc);
+
+    constexpr size_t spike = 1 << 20;
+    {
+        core::ScopedArena scratch(allocator);
+        scratch.Allocate(spike);
+    }
+    allocator.Allocate(1024);
+    allocator.Reset();
+    CORE_CHECK(core::MemoryTracker::GetStats(core::MemoryTag::Game).arenaHighWater >= static_cast<int64_t>(spike));
+}
+
+// 할당 직후는 0xCD, 되감긴 뒤는 0xDD 로 채워지고, 할당 뒤의 가드 바이트를 덮어쓰면 ValidateGuards 가 잡는다
+// core_test 는 CORE_FRAME_ALLOCATOR_DEBUG=1, CORE_FRAME_ALLOCATOR_GUARD_BYTES=16 으로 빌드된다 (CMakeLists.txt)
+CORE_TEST(FrameAllocatorDebugFillAndGuards)
+{
+    static_assert(CORE_FRAME_ALLOCATOR_DEBUG && CORE_FRAME_ALLOCATOR_GUARD_BYTES > 0);
+    core::FrameAllocator allocator(16 * 1024);
+
+    auto* block = static_cast<unsigned char*>(allocator.Allocate(64));
+    bool filled = true;
+    for (size_t i = 0; i < 64; ++i)
+        filled &= block[i] == 0xCD;
+    CORE_CHECK(filled);
+
+#if !CORE_ASAN_ENABLED
+    bool guarded = true;
+    for (size_t i = 0; i < CORE_FRAME_ALLOCATOR_GUARD_BYTES; ++i)
+        guarded &= block[64 + i] == 0xFD;
+    CORE_CHECK(guarded);
+    CORE_CHECK(allocator.ValidateGuards());
+
+    // 한 바이트 넘쳐 쓰면 손상으로 보고된다. 되감기 전에 되돌려 두지 않으면 디버그 빌드의 assert 에 걸린다
+    block[64] = 0;
+    CORE_CHECK(!allocator.ValidateGuards());
+    block[64] = 0xFD;
+    CORE_CHECK(allocator.ValidateGuards());
+
+    const core::FrameAllocator::Marker marker = allocator.GetMarker();
+    auto* scratch = static_cast<unsigned char*>(allocator.Allocate(32));
+    std::memset(scratch, 0x11, 32);
+    allocator.RollbackTo(marker);
+    bool freed = true;
+    for (size_t i = 0; i < 32; ++i)
+        freed &= scratch[i] == 0xDD;
+    CORE_CHECK(freed);
+    CORE_CHECK(block[0] == 0xCD);
+
+    allocator.Reset();
+    CORE_CHECK(block[0] == 0xDD && block[63] == 0xDD);
+#endif
+}
@@ -0,0 +1,66 @@
+﻿#include <cstdint>
+
+#include <core/FrameContainers.hpp>
+
+#include "AllocationCounter.hpp"
+#include "Test.hpp"
+
+namespace
+{
+    bool IsInArena(const core::FrameAllocator& allocator, const void* p, uintptr_t begin)
+    {
+        const uintptr_t address = reinterpret_cast<uintptr_t>(p);
+        return address >= begin && address < begin + allocator.GetCapacity();
+    }
+}
+
+// frame 컨테이너는 커지면서도 원소 메모리를 아레나에서만 가져오고, 중첩된 frame::string 에도 같은 아레나가 전달된다
+CORE_TEST(FrameContainersUseArena)
+{
+    core::FrameAllocator allocator(256 * 1024);
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(allocator.Allocate(1, 1));
+
+    test::AllocationScope scope;
+    {
+        core::frame::vector<int> numbers(&allocator);
+        for (int i = 0; i < 1000; ++i)
+            numbers.push_back(i);
+
+        core::frame::vector<core::frame::string> names(&allocator);
+        for (int i = 0; i < 16; ++i)
+            names.emplace_back("a frame lifetime string that does not fit in SSO");
+
+        core::frame::unordered_map<int, int> lookup(&allocator);
+        for (int i = 0; i < 256; ++i)
+            lookup.emplace(i, i * 2);
+
+        bool ordered = true;
+        for (int i = 0; i < 1000; ++i)
+            ordered &= numbers[i] == i;
+        CORE_CHECK(ordered);
+        CORE_CHECK(lookup.at(100) == 200);
+
+        CORE_CHECK(IsInArena(allocator, numbers.data(), begin));
+        CORE_CHECK(names.back().get_allocator().resource() == &allocator);
+        CORE_CHECK(IsInArena(allocator, names.back().data(), begin));
+        CORE_CHECK(names.back().size() > 40);
+    }
+    CORE_CHECK(scope.GetCount() == 0);
+    CORE_CHECK(allocator.GetChunkCount() == 1);
+
+    allocator.Reset();
+}
+
+// ScopedArena 에 만든 컨테이너는 스코프가 끝나면 메모리가 되감긴다
+CORE_TEST(FrameContainersOnScopedArena)
+{
+    core::FrameAllocator allocator(64 * 1024);
+    const size_t usedBefore = allocator.GetUsedSize();
+    {
+        core::ScopedArena scratch(allocator);
+        core::frame::vector<float> sorted(&scratch);
+        sorted.resize(1024, 1.0f);
+        CORE_CHECK(allocator.GetUsedSize() >= usedBefore + 1024 * sizeof(float));
+    }
+    CORE_CHECK(allocator.GetUsedSize() == usedBefore);
+}
@@ -0,0 +1,61 @@
+﻿#include <atomic>
+#include <string>
+#include <stdexcept>
+
+#include <core/Future.hpp>
+
+#include "Test.hpp"
+
+// 값은 Then 체인을 따라 전달된다
+CORE_TEST(FutureThenChainsValues)
+{
+    core::ThreadPool pool(2);
+
+    core::Future<std::string> result = pool.Submit([] { return 20; })
+        .Then([](int& v) { return v + 1; })
+        .Then([](int& v) { return std::to_string(v * 2); });
+    CORE_CHECK(result.Get() == "42");
+}
+
+// 앞 단계가 던지면 뒤 단계 함수는 실행되지 않고 예외만 끝까지 전달된다. OnComplete 는 그래도 실행된다
+CORE_TEST(FutureThenPropagatesErrors)
+{
+    core::ThreadPool pool(2);
+
+    std::atomic<int> skipped{ 0 };
+    std::atomic<bool> completed{ false };
+    core::Future<int> failed = pool.Submit([]() -> int { throw std::runtime_error("load failed"); });
+    core::Future<int> tail = failed
+        .Then([&](int& v) { skipped.fetch_add(1); return v + 1; })
+        .Then([&](int& v) { skipped.fetch_add(1); return v + 1; });
+    failed.OnComplete([&] { completed.store(true); });
+
+    bool caught = false;
+    try
+    {
+        tail.Get();
+    }
+    catch (const std::runtime_error& e)
+    {
+        caught = std::string(e.what()) == "load failed";
+    }
+    CORE_CHECK(caught);
+    CORE_CHECK(skipped.load() == 0);
+
+    pool.WaitAll();
+    CORE_CHECK(completed.load());
+
+    // 후속 함수가 던진 예외도 같은 방식으로 전달된다
+    core::Future<void> thrownInThen = pool.Submit([] { return 1; })
+        .Then([](int&) { throw std::logic_error("bad value"); });
+    caught = false;
+    try
+    {
+        thrownInThen.Get();
+    }
+    catch (const std::logic_error&)
+    {
+        caught = true;
+    }
+    CORE_CHECK(caught);
+}
@@ -0,0 +1,85 @@
+﻿#include <array>
+#include <atomic>
+
+#include <core/Job.hpp>
+#include <core/ThreadPool.hpp>
+
+#include "AllocationCounter.hpp"
+#include "Test.hpp"
+
+// Job 은 캡처를 내부 버퍼에 두므로 생성 / 이동 / 실행에 힙 할당이 없다
+CORE_TEST(JobInlineCaptureDoesNotAllocate)
+{
+    std::array<uint64_t, 5> payload{ 1, 2, 3, 4, 5 };   // 40 바이트 캡처
+    uint64_t sum = 0;
+
+    test::AllocationScope scope;
+    {
+        core::Job job([payload, &sum] { for (uint64_t v : payload) sum += v; });
+        core::Job moved(std::move(job));
+        core::Job assigned;
+        assigned = std::move(moved);
+        assigned();
+    }
+    CORE_CHECK(scope.GetCount() == 0);
+    CORE_CHECK(sum == 15);
+}
+
+// 슬롯을 재사용하는 동안에는 블록을 추가하지 않는다
+CORE_TEST(JobSlabReuseDoesNotAllocate)
+{
+    core::internal::JobSlab slab(64);
+    int runs = 0;
+
+    test::AllocationScope scope;
+    for (int frame = 0; frame < 100; ++frame)
+    {
+        core::internal::JobItem* items[64];
+        for (auto& item : items)
+            item = slab.Allocate(core::Job([&runs] { ++runs; }), nullptr);
+        for (auto* item : items)
+        {
+            item->fn();
+            core::internal::JobSlab::Free(item);
+        }
+    }
+    CORE_CHECK(scope.GetCount() == 0);
+    CORE_CHECK(slab.GetCapacity() == 64);
+    CORE_CHECK(runs == 64 * 100);
+}
+
+// 워밍업 이후 정상 상태의 Enqueue / 실행 / Wait 는 힙 할당이 없다 (워커 스레드 포함)
+CORE_TEST(ThreadPoolSteadyStateSubmitDoesNotAllocate)
+{
+    core::ThreadPool pool(2);
+    std::atomic<int> runs{ 0 };
+
+    auto submitBatch = [&]
+    {
+        core::JobCounter counter;
+        for (int i = 0; i < 512; ++i)
+        {
+            pool.Enqueue([&runs] { runs.fetch_add(1, std::memory_order_relaxed); }, &counter);
+            if (i % 64 == 0)
+            {
+                // 워커가 실행 중에 넣는 작업 (로컬 큐 경로)
+                pool.Enqueue([&pool, &runs, &counter]
+                {
+                    for (int j = 0; j < 16; ++j)
+                        pool.Enqueue([&runs] { runs.fetch_add(1, std::memory_order_relaxed); }, &counter);
+                }, &counter);
+            }
+        }
+        pool.Wait(counter);
+    };
+
+    // 슬랩 / 큐가 최대 용량에 도달하도록 워밍업
+    for (int i = 0; i < 8; ++i)
+        submitBatch();
+
+    test::AllocationScope scope;
+    for (int i = 0; i < 100; ++i)
+        submitBatch();
+    CORE_CHECK(scope.GetCount() == 0);
+    CORE_CHECK(runs.load() == 108 * (512 + 8 * 16));
+}
@@ -0,0 +1,167 @@
+﻿#include <atomic>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <filesystem>
+#include <type_traits>
+
+#include <core/Log.hpp>
+
+#include "Test.hpp"
+
+namespace
+{
+    struct RecordingSink : core::ILogSink
+    {
+        explicit RecordingSink(bool async = false, spdlog::level::level_enum minLevel = spdlog::level::trace)
+            : async(async), minLevel(minLevel) {}
+
+        void OnMessage(std::string_view msg, int) override { messages.emplace_back(msg); }
+        bool WantsAsync() const override { return async; }
+        spdlog::level::level_enum GetDefaultMinLevel() const override { return minLevel; }
+
+        bool                      async;
+        spdlog::level::level_enum minLevel;
+        std::vector<std::string>  messages;
+    };
+
+    // 최소 수준이 Log 쪽에 있으므로 sink 는 평범한 값 타입일 수 있다
+    static_assert(std::is_copy_constructible_v<RecordingSink>);
+
+    // flush 스레드와 Flush 를 부른 스레드가 동시에 부를 수 있는 sink
+    struct CountingSink : core::ILogSink
+    {
+        void OnMessage(std::string_view, int) override
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++count;
+        }
+
+        size_t GetCount()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return count;
+        }
+
+        std::mutex mutex;
+        size_t     count = 0;
+    };
+}
+
+// 배달 스레드가 없을 때 느린 sink 의 메시지는 버려지지 않고 바로 전달된다
+CORE_TEST(LogAsyncSinkWithoutThreadDeliversInline)
+{
+    auto sink = std::make_shared<RecordingSink>(true);
+    core::Log::AddSink(sink);     // Init 전이라 배달 스레드가 시작되지 않는다
+
+    const uint64_t droppedBefore = core::Log::GetDroppedCount();
+    core::Log::DispatchToSinks("before init", spdlog::level::info);
+
+    CORE_CHECK(sink->messages.size() == 1 && sink->messages[0] == "before init");
+    CORE_CHECK(core::Log::GetDroppedCount() == droppedBefore);
+    CORE_CHECK(core::Log::RemoveSink(sink));
+}
+
+// 최소 수준은 AddSink 때 GetDefaultMinLevel 로 정해지고 SetSinkMinLevel 로 바뀐다
+CORE_TEST(LogSinkMinLevel)
+{
+    auto sink = std::make_shared<RecordingSink>(false, spdlog::level::warn);
+    core::Log::AddSink(sink);
+
+    core::Log::DispatchToSinks("info", spdlog::level::info);
+    core::Log::DispatchToSinks("warn", spdlog::level::warn);
+    CORE_CHECK(sink->messages.size() == 1 && sink->messages[0] == "warn");
+
+    CORE_CHECK(core::Log::SetSinkMinLevel(sink, spdlog::level::trace));
+    core::Log::DispatchToSinks("trace", spdlog::level::trace);
+    CORE_CHECK(sink->messages.size() == 2 && sink->messages[1] == "trace");
+
+    CORE_CHECK(core::Log::RemoveSink(sink));
+    CORE_CHECK(!core::Log::SetSinkMinLevel(sink, spdlog::level::info));
+}
+
+// Flush 는 Init 하지 않은 스레드에서 불러도 비동기 백엔드를 멈추지 않고, 이후 메시지도 계속 기록된다
+CORE_TEST(LogFlushFromAnotherThread)
+{
+    core::LogConfig config;
+    config.async = true;
+    config.console = false;
+    config.flushInterval = std::chrono::milliseconds(10'000);
+    config.filePath = (std::filesystem::temp_directory_path() / "core_test_flush.log").string();
+    core::Log::Init(config);
+
+    auto sink = std::make_shared<CountingSink>();
+    core::Log::AddSink(sink);
+
+    constexpr size_t Messages = 500;
+    std::thread writer([]
+    {
+        for (size_t i = 0; i < Messages; ++i)
+            core::Log::Write(core::LogCategory::Core, spdlog::level::info, "flush me");
+        core::Log::Flush();
+    });
+    writer.join();
+    CORE_CHECK(core::Log::IsAsync());
+
+    core::Log::Write(core::LogCategory::Core, spdlog::level::info, "after flush");
+    core::Log::Shutdown();
+    CORE_CHECK(sink->GetCount() == Messages + 1);
+
+    CORE_CHECK(core::Log::RemoveSink(sink));
+    core::Log::SetLevel(spdlog::level::off);
+    std::filesystem::remove(config.filePath);
+}
+
+// 여러 스레드가 로그를 남기는 동안 sink 를 붙였다 떼도, RemoveSink 가 돌아온 뒤에는 그 sink 가 다시 불리지 않는다
+CORE_TEST(LogSinkListChangesWhileDispatching)
+{
+    struct GuardedSink : core::ILogSink
+    {
+        void OnMessage(std::string_view, int) override
+        {
+            if (removed.load(std::memory_order_acquire))
+                lateCalls.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::atomic<bool> removed{ false };
+        std::atomic<int>  lateCalls{ 0 };
+    };
+
+    auto stable = std::make_shared<CountingSink>();
+    core::Log::AddSink(stable);
+
+    constexpr int Threads = 4;
+    constexpr size_t MessagesPerThread = 5000;
+    std::atomic<bool> start{ false };
+    std::vector<std::thread> writers;
+    for (int t = 0; t < Threads; ++t)
+    {
+        writers.emplace_back([&]
+        {
+            while (!start.load())
+                std::this_thread::yield();
+            for (size_t i = 0; i < MessagesPerThread; ++i)
+                core::Log::DispatchToSinks("message", spdlog::level::info);
+        });
+    }
+
+    start.store(true);
+    int lateCalls = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        auto transient = std::make_shared<GuardedSink>();
+        core::Log::AddSink(transient);
+        core::Log::SetSinkMinLevel(transient, spdlog::level::warn);
+        CORE_CHECK(core::Log::RemoveSink(transient));
+        transient->removed.store(true, std::memory_order_release);
+        lateCalls += transient->lateCalls.load();
+    }
+    for (std::thread& writer : writers)
+        writer.join();
+
+    CORE_CHECK(lateCalls == 0);
+    CORE_CHECK(stable->GetCount() == Threads * MessagesPerThread);
+    CORE_CHECK(core::Log::RemoveSink(stable));
+}
@@ -0,0 +1,61 @@
+﻿#include <core/MemoryTracker.hpp>
+
+#include "Test.hpp"
+
+namespace
+{
+    struct BudgetCall
+    {
+        core::MemoryTag tag = core::MemoryTag::Count;
+        int64_t current = 0;
+        int64_t budget = 0;
+    };
+
+    int s_BudgetCalls = 0;
+    BudgetCall s_LastCall;
+
+    void RecordBudgetCall(core::MemoryTag tag, int64_t current, int64_t budget)
+    {
+        ++s_BudgetCalls;
+        s_LastCall = BudgetCall{ tag, current, budget };
+    }
+}
+
+// 예산을 넘으면 핸들러는 한 번만 불리고, 예산 아래로 내려갔다가 다시 넘을 때 다시 불린다
+CORE_TEST(MemoryTrackerBudgetHandlerFiresOncePerOverrun)
+{
+    constexpr core::MemoryTag tag = core::MemoryTag::Graphics;
+    const int64_t base = core::MemoryTracker::GetStats(tag).current;
+
+    core::MemoryTracker::SetBudgetHandler(&RecordBudgetCall);
+    core::MemoryTracker::SetBudget(tag, base + 1000);
+
+    core::MemoryTracker::RecordAlloc(tag, 600);
+    CORE_CHECK(s_BudgetCalls == 0);
+    core::MemoryTracker::RecordAlloc(tag, 600);
+    CORE_CHECK(s_BudgetCalls == 1);
+    CORE_CHECK(s_LastCall.tag == tag && s_LastCall.current == base + 1200 && s_LastCall.budget == base + 1000);
+
+    // 넘은 상태가 이어지는 동안은 다시 알리지 않는다
+    core::MemoryTracker::RecordAlloc(tag, 600);
+    CORE_CHECK(s_BudgetCalls == 1);
+
+    core::MemoryTracker::RecordFree(tag, 600);
+    core::MemoryTracker::RecordFree(tag, 600);
+    core::MemoryTracker::RecordAlloc(tag, 600);
+    CORE_CHECK(s_BudgetCalls == 2);
+
+    const core::MemoryTagStats stats = core::MemoryTracker::GetStats(tag);
+    CORE_CHECK(stats.current == base + 1200);
+    CORE_CHECK(stats.peak >= base + 1800);
+
+    // 예산 0 은 제한 없음
+    core::MemoryTracker::SetBudget(tag, 0);
+    core::MemoryTracker::RecordAlloc(tag, 4096);
+    CORE_CHECK(s_BudgetCalls == 2);
+
+    core::MemoryTracker::RecordFree(tag, 4096);
+    core::MemoryTracker::RecordFree(tag, 1200);
+    core::MemoryTracker::SetBudgetHandler(nullptr);
+    CORE_CHECK(core::MemoryTracker::GetStats(tag).current == base);
+}
@@ -0,0 +1,57 @@
+﻿#include <cstring>
+
+#include <core/MultiFrameAllocator.hpp>
+
+#include "Test.hpp"
+
+namespace
+{
+    struct Counted
+    {
+        static inline int s_Alive = 0;
+
+        Counted() { ++s_Alive; }
+        ~Counted() { --s_Alive; }
+    };
+}
+
+// 한 프레임에 할당한 데이터는 뒤따르는 N-1 프레임 동안 그대로 남고, 그 프레임이 retire 될 때만 되감긴다
+CORE_TEST(MultiFrameAllocatorRetainsInFlightFrames)
+{
+    constexpr size_t Frames = 3;
+    core::MultiFrameAllocator<Frames> allocator(64 * 1024);
+
+    unsigned char* data[Frames] = {};
+    Counted::s_Alive = 0;
+    for (uint64_t frame = 0; frame < Frames; ++frame)
+    {
+        CORE_CHECK(allocator.CanBeginFrame(frame));
+        allocator.BeginFrame(frame);
+        data[frame] = static_cast<unsigned char*>(allocator.Allocate(256));
+        std::memset(data[frame], static_cast<int>(0xA0 + frame), 256);
+        allocator.Create<Counted>();
+    }
+    CORE_CHECK(allocator.GetFramesInFlight() == Frames);
+    CORE_CHECK(Counted::s_Alive == static_cast<int>(Frames));
+
+    // 모든 슬롯이 in-flight 인 동안 앞선 프레임의 데이터가 덮어쓰이지 않는다
+    bool intact = true;
+    for (uint64_t frame = 0; frame < Frames; ++frame)
+    {
+        for (size_t i = 0; i < 256; ++i)
+            intact &= data[frame][i] == static_cast<unsigned char>(0xA0 + frame);
+    }
+    CORE_CHECK(intact);
+    CORE_CHECK(!allocator.CanBeginFrame(Frames));
+
+    // frame 0 이 retire 되어야 그 슬롯을 frame N 이 다시 쓴다. 나머지 프레임은 그대로 살아 있다
+    allocator.BeginFrame(Frames, 0);
+    CORE_CHECK(Counted::s_Alive == static_cast<int>(Frames) - 1);
+    CORE_CHECK(allocator.GetFramesInFlight() == Frames);
+    CORE_CHECK(allocator.GetCurrentFrame() == Frames);
+    CORE_CHECK(data[1][0] == 0xA1 && data[2][255] == 0xA2);
+
+    allocator.Retire(Frames);
+    CORE_CHECK(Counted::s_Alive == 0);
+    CORE_CHECK(allocator.GetFramesInFlight() == 0);
+}
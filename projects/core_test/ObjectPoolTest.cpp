@@ -0,0 +1,55 @@
+﻿#include <core/ObjectPool.hpp>
+
+#include "Test.hpp"
+
+// 슬롯이 재사용되면 세대가 올라가므로 해제된 객체의 핸들은 새 객체에 닿지 않는다
+CORE_TEST(ObjectPoolRejectsStaleHandles)
+{
+    core::ObjectPool<int> pool;
+
+    const auto first = pool.Create(1);
+    CORE_CHECK(first.IsValid());
+    CORE_CHECK(pool.Get(first) && *pool.Get(first) == 1);
+
+    CORE_CHECK(pool.Destroy(first));
+    CORE_CHECK(!pool.IsAlive(first));
+    CORE_CHECK(!pool.Destroy(first));
+
+    const auto second = pool.Create(2);
+    CORE_CHECK(second.GetIndex() == first.GetIndex());
+    CORE_CHECK(second.GetGeneration() != first.GetGeneration());
+    CORE_CHECK(pool.Get(first) == nullptr);
+    CORE_CHECK(!pool.Destroy(first));
+    CORE_CHECK(pool.Get(second) && *pool.Get(second) == 2);
+    CORE_CHECK(pool.GetSize() == 1);
+
+    // 기본 핸들과 범위를 벗어난 인덱스도 거부한다
+    CORE_CHECK(pool.Get(core::ObjectPool<int>::Handle{}) == nullptr);
+    CORE_CHECK(pool.Get(core::ObjectPool<int>::Handle(100000, 1)) == nullptr);
+
+    // Clear 이후에는 남아 있던 핸들도 모두 무효
+    pool.Clear();
+    CORE_CHECK(!pool.IsAlive(second));
+    CORE_CHECK(pool.GetSize() == 0);
+}
+
+// 세대가 한 바퀴 돌면 슬롯을 은퇴시키므로, 같은 슬롯을 계속 재사용해도 옛 핸들이 다시 맞지 않는다
+CORE_TEST(ObjectPoolRetiresExhaustedSlots)
+{
+    using Pool = core::ObjectPool<int, uint32_t, 1>;
+    Pool pool;
+
+    const Pool::Handle first = pool.Create(0);
+    pool.Destroy(first);
+    for (uint32_t generation = 2; generation <= Pool::Handle::MaxGeneration; ++generation)
+    {
+        const Pool::Handle h = pool.Create(0);
+        CORE_CHECK(h.GetIndex() == 0 && h.GetGeneration() == generation);
+        pool.Destroy(h);
+    }
+
+    const Pool::Handle next = pool.Create(0);
+    CORE_CHECK(next.GetIndex() == 1);
+    CORE_CHECK(!pool.IsAlive(first));
+    CORE_CHECK(pool.GetCapacity() == 2);
+}
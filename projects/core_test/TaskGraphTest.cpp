@@ -0,0 +1,85 @@
+﻿#include <array>
+#include <atomic>
+#include <stdexcept>
+
+#include <core/TaskGraph.hpp>
+
+#include "Test.hpp"
+
+// 간선으로 연결된 작업은 선행 작업이 끝난 뒤에 시작하고, 같은 그래프를 여러 번 다시 실행할 수 있다
+CORE_TEST(TaskGraphRunsInDependencyOrder)
+{
+    core::ThreadPool pool(4);
+    core::TaskGraph graph;
+
+    // a -> (b, c) -> d -> e, 그리고 독립된 f
+    std::atomic<int> clock{ 0 };
+    std::array<std::atomic<int>, 6> stamp{};
+    auto task = [&](size_t i) { return graph.AddTask([&, i] { stamp[i].store(++clock); }); };
+
+    const core::TaskHandle a = task(0), b = task(1), c = task(2), d = task(3), e = task(4), f = task(5);
+    graph.AddEdge(a, b);
+    graph.AddEdge(a, c);
+    graph.AddEdge(b, d);
+    graph.AddEdge(c, d);
+    graph.AddEdge(d, e);
+    CORE_CHECK(graph.IsAcyclic());
+
+    for (int run = 0; run < 50; ++run)
+    {
+        clock.store(0);
+        graph.Submit(pool);
+        graph.Wait(d);
+        CORE_CHECK(graph.IsDone(a) && graph.IsDone(b) && graph.IsDone(c) && graph.IsDone(d));
+        graph.WaitAll();
+
+        CORE_CHECK(stamp[0] < stamp[1] && stamp[0] < stamp[2]);
+        CORE_CHECK(stamp[1] < stamp[3] && stamp[2] < stamp[3]);
+        CORE_CHECK(stamp[3] < stamp[4]);
+        CORE_CHECK(stamp[5] > 0 && clock.load() == 6);
+        CORE_CHECK(graph.IsDone(f));
+    }
+}
+
+// 순환 간선은 IsAcyclic 으로 걸러진다 (Submit 은 디버그 빌드에서 assert)
+CORE_TEST(TaskGraphDetectsCycles)
+{
+    core::TaskGraph graph;
+    const core::TaskHandle a = graph.AddTask({});
+    const core::TaskHandle b = graph.AddTask({});
+    const core::TaskHandle c = graph.AddTask({});
+    graph.AddEdge(a, b);
+    graph.AddEdge(b, c);
+    CORE_CHECK(graph.IsAcyclic());
+
+    graph.AddEdge(c, a);
+    CORE_CHECK(!graph.IsAcyclic());
+
+    graph.Clear();
+    CORE_CHECK(graph.GetTaskCount() == 0 && graph.IsAcyclic());
+}
+
+// 작업이 던진 예외는 Wait 에서 다시 던져지고, 후속 작업은 그래도 실행되어 대기가 멈추지 않는다
+CORE_TEST(TaskGraphRethrowsTaskException)
+{
+    core::ThreadPool pool(2);
+    core::TaskGraph graph;
+
+    std::atomic<bool> successorRan{ false };
+    const core::TaskHandle failing = graph.AddTask([] { throw std::runtime_error("task failed"); });
+    const core::TaskHandle after = graph.AddTask([&] { successorRan.store(true); });
+    graph.AddEdge(failing, after);
+
+    graph.Submit(pool);
+    bool caught = false;
+    try
+    {
+        graph.WaitAll();
+    }
+    catch (const std::runtime_error&)
+    {
+        caught = true;
+    }
+    CORE_CHECK(caught);
+    CORE_CHECK(successorRan.load());
+}
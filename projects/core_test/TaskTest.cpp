@@ -0,0 +1,67 @@
+﻿#include <chrono>
+#include <thread>
+#include <string>
+#include <stdexcept>
+
+#include <core/Task.hpp>
+
+#include "Test.hpp"
+
+namespace
+{
+    // 재개되지 않는 코루틴 때문에 테스트가 멈추지 않도록 기한을 두고 기다린다
+    // 작업을 돕지 않으므로, 워커 하나짜리 풀에서는 코루틴이 실제로 중단된 뒤에야 Submit 한 작업이 실행된다
+    template<typename T>
+    bool WaitFor(const core::Future<T>& future, std::chrono::seconds timeout)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (!future.IsReady())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    core::Task<std::string> AwaitThrowingSubmit(core::ThreadPool& pool)
+    {
+        try
+        {
+            co_await pool.Submit([]() -> int { throw std::runtime_error("load failed"); });
+            co_return "resumed without exception";
+        }
+        catch (const std::runtime_error& e)
+        {
+            co_return std::string("caught: ") + e.what();
+        }
+    }
+
+    core::Task<int> AwaitThrowingSubmitUncaught(core::ThreadPool& pool)
+    {
+        co_await pool.Submit([] { throw std::logic_error("decode failed"); });
+        co_return 0;
+    }
+}
+
+// 실패한 Future 를 co_await 해도 코루틴이 재개되고 예외가 코루틴 안에서 다시 던져진다
+CORE_TEST(TaskAwaitThrowingSubmitResumesWithException)
+{
+    core::ThreadPool pool(1);
+
+    core::Future<std::string> caught = core::Spawn(pool, AwaitThrowingSubmit(pool));
+    CORE_CHECK(WaitFor(caught, std::chrono::seconds(5)));
+    if (caught.IsReady())
+        CORE_CHECK(caught.Get() == "caught: load failed");
+
+    // 코루틴이 잡지 않은 예외는 Spawn 한 Future 로 전달된다
+    core::Future<int> uncaught = core::Spawn(pool, AwaitThrowingSubmitUncaught(pool));
+    CORE_CHECK(WaitFor(uncaught, std::chrono::seconds(5)));
+    if (uncaught.IsReady())
+    {
+        bool threw = false;
+        try { uncaught.Get(); }
+        catch (const std::logic_error&) { threw = true; }
+        CORE_CHECK(threw);
+    }
+}
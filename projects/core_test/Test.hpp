@@ -0,0 +1,45 @@
+﻿#pragma once
+#include <cstdio>
+#include <vector>
+
+// core 테스트용 최소 하네스
+// CORE_TEST(Name) 으로 등록한 함수를 main 에서 모두 실행하고, CORE_CHECK 가 하나라도 실패하면 0 이 아닌 값으로 끝난다
+namespace test
+{
+    struct TestCase
+    {
+        const char* name;
+        void (*fn)();
+    };
+
+    inline std::vector<TestCase>& GetRegistry()
+    {
+        static std::vector<TestCase> s_Cases;
+        return s_Cases;
+    }
+
+    inline int& GetFailureCount()
+    {
+        static int s_Failures = 0;
+        return s_Failures;
+    }
+
+    struct TestRegistrar
+    {
+        TestRegistrar(const char* name, void (*fn)()) { GetRegistry().push_back({ name, fn }); }
+    };
+
+    inline void ReportFailure(const char* expr, const char* file, int line)
+    {
+        std::printf("  FAILED: %s (%s:%d)\n", expr, file, line);
+        ++GetFailureCount();
+    }
+}
+
+#define CORE_TEST(Name) \
+    static void Name(); \
+    static test::TestRegistrar s_##Name##Registrar(#Name, &Name); \
+    static void Name()
+
+#define CORE_CHECK(expr) \
+    do { if (!(expr)) test::ReportFailure(#expr, __FILE__, __LINE__); } while (false)
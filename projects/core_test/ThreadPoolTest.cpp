@@ -0,0 +1,184 @@
+﻿#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <functional>
+#include <vector>
+
+#include <core/ThreadPool.hpp>
+
+#include "Test.hpp"
+
+namespace
+{
+    // 유일한 워커를 붙잡아 두는 작업. 나머지 작업은 테스트 스레드가 직접 꺼내 실행한다
+    struct WorkerBlocker
+    {
+        explicit WorkerBlocker(core::ThreadPool& pool)
+        {
+            pool.Enqueue([this] { started.store(true); while (!release.load()) std::this_thread::yield(); });
+            while (!started.load())
+                std::this_thread::yield();
+        }
+
+        void Release() { release.store(true); }
+
+        std::atomic<bool> started{ false };
+        std::atomic<bool> release{ false };
+    };
+}
+
+// 워커가 하나뿐인 풀에서 작업이 자기 하위 작업을 기다려도, 대기하는 작업이 하위 작업을 직접 실행하므로 교착되지 않는다
+CORE_TEST(ThreadPoolWaitInsideJobRunsChildren)
+{
+    core::ThreadPool pool(1);
+
+    std::atomic<int> children{ 0 };
+    std::atomic<bool> parentDone{ false };
+    core::JobCounter parent;
+    pool.Enqueue([&]
+    {
+        core::JobCounter counter;
+        for (int i = 0; i < 8; ++i)
+            pool.Enqueue([&children] { children.fetch_add(1); }, &counter);
+        pool.Wait(counter);
+        parentDone.store(children.load() == 8);
+
+        // WaitAll 도 호출한 작업 자신은 제외하고 기다린다
+        pool.Enqueue([&children] { children.fetch_add(1); });
+        pool.WaitAll();
+    }, &parent);
+
+    pool.Wait(parent);
+    CORE_CHECK(parentDone.load());
+    CORE_CHECK(children.load() == 9);
+}
+
+// 외부 스레드의 Wait 도 큐의 작업을 직접 실행한다
+CORE_TEST(ThreadPoolExternalWaitHelps)
+{
+    core::ThreadPool pool(1);
+
+    // 유일한 워커를 붙잡아 두면 나머지 작업은 대기 중인 메인 스레드가 실행해야 한다
+    WorkerBlocker blocker(pool);
+
+    std::atomic<int> ran{ 0 };
+    core::JobCounter counter;
+    for (int i = 0; i < 4; ++i)
+        pool.Enqueue([&ran] { ran.fetch_add(1); }, &counter);
+
+    pool.Wait(counter);
+    CORE_CHECK(ran.load() == 4);
+
+    blocker.Release();
+    pool.WaitAll();
+}
+
+// 높은 우선순위 작업부터 꺼내되, StarvationInterval 번에 한 번은 낮은 우선순위를 먼저 본다
+CORE_TEST(ThreadPoolPriorityLanes)
+{
+    core::ThreadPool pool(1);
+    WorkerBlocker blocker(pool);
+
+    std::vector<core::JobPriority> order;
+    auto record = [&order](core::JobPriority p) { return [&order, p] { order.push_back(p); }; };
+    pool.Enqueue(record(core::JobPriority::Background), core::JobPriority::Background);
+    pool.Enqueue(record(core::JobPriority::Normal), core::JobPriority::Normal);
+    pool.Enqueue(record(core::JobPriority::High), core::JobPriority::High);
+
+    // 기아 방지 주기는 스레드별 카운터라 새 스레드에서 꺼낸다
+    std::thread([&] { while (pool.TryRunOne()) {} }).join();
+    CORE_CHECK(order.size() == 3);
+    CORE_CHECK(order[0] == core::JobPriority::High && order[1] == core::JobPriority::Normal && order[2] == core::JobPriority::Background);
+
+    order.clear();
+    pool.Enqueue(record(core::JobPriority::Background), core::JobPriority::Background);
+    for (uint32_t i = 0; i < core::ThreadPool::StarvationInterval * 2; ++i)
+        pool.Enqueue(record(core::JobPriority::High), core::JobPriority::High);
+
+    std::thread([&] { for (uint32_t i = 0; i < core::ThreadPool::StarvationInterval; ++i) pool.TryRunOne(); }).join();
+    CORE_CHECK(order.size() == core::ThreadPool::StarvationInterval);
+    CORE_CHECK(!order.empty() && order.back() == core::JobPriority::Background);
+
+    blocker.Release();
+    pool.WaitAll();
+}
+
+// 친화 큐 작업은 워커가 실행하지 않고, Pump 를 호출한 스레드가 그 시점에 쌓인 만큼만 실행한다
+CORE_TEST(ThreadPoolAffinityQueuePump)
+{
+    core::ThreadPool pool(2);
+    const std::thread::id mainThread = std::this_thread::get_id();
+
+    std::atomic<int> ranOnMain{ 0 };
+    std::atomic<int> ranElsewhere{ 0 };
+    core::JobCounter counter;
+    auto mainJob = [&] { (std::this_thread::get_id() == mainThread ? ranOnMain : ranElsewhere).fetch_add(1); };
+
+    // 워커 안에서 메인 큐로 넘긴다
+    pool.Enqueue([&] { for (int i = 0; i < 3; ++i) pool.EnqueueTo(core::ThreadPool::MainQueue, mainJob, &counter); });
+    pool.WaitAll();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    CORE_CHECK(ranOnMain.load() == 0 && ranElsewhere.load() == 0);
+    CORE_CHECK(!counter.IsDone());
+
+    CORE_CHECK(pool.Pump(core::ThreadPool::MainQueue, 2) == 2);
+    CORE_CHECK(pool.Pump(core::ThreadPool::MainQueue) == 1);
+    CORE_CHECK(counter.IsDone());
+    CORE_CHECK(ranOnMain.load() == 3 && ranElsewhere.load() == 0);
+
+    // Pump 중에 같은 큐에 다시 넣은 작업은 다음 Pump 로 넘어간다
+    int reposts = 0;
+    std::function<void()> repost = [&] { ++reposts; pool.EnqueueTo(core::ThreadPool::MainQueue, [&] { repost(); }); };
+    pool.EnqueueTo(core::ThreadPool::MainQueue, [&] { repost(); });
+    CORE_CHECK(pool.Pump(core::ThreadPool::MainQueue) == 1);
+    CORE_CHECK(reposts == 1);
+    CORE_CHECK(pool.Pump(core::ThreadPool::MainQueue) == 1);
+    CORE_CHECK(reposts == 2);
+
+    // 남은 재등록 작업은 더 이상 다시 넣지 않고 비운다
+    repost = [] {};
+    pool.Pump(core::ThreadPool::MainQueue);
+}
+
+// 통계를 켠 상태에서 워커가 로컬 큐에 넣은 작업을 다른 워커가 훔쳐 가도, 모든 작업의 대기 시간이 한 번씩 기록된다
+CORE_TEST(ThreadPoolStatsRecordStolenJobLatency)
+{
+    core::ThreadPool pool(4);
+    pool.EnableStats(true);
+    const auto begin = std::chrono::steady_clock::now();
+
+    constexpr int Children = 2000;
+    std::atomic<int> ran{ 0 };
+    for (int round = 0; round < 4; ++round)
+    {
+        pool.Enqueue([&]
+        {
+            for (int i = 0; i < Children; ++i)
+                pool.Enqueue([&] { ran.fetch_add(1, std::memory_order_relaxed); });
+        });
+    }
+    pool.WaitAll();
+    const uint64_t elapsedUs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count());
+    CORE_CHECK(ran.load() == Children * 4);
+
+    const core::ThreadPoolStats stats = pool.GetStats();
+    uint64_t executed = 0;
+    uint64_t recorded = 0;
+    size_t highestBucket = 0;
+    for (const core::WorkerStats& worker : stats.workers)
+    {
+        executed += worker.jobsExecuted;
+        for (size_t b = 0; b < core::JobLatencyBuckets; ++b)
+        {
+            recorded += worker.latencyHistogram[b];
+            if (worker.latencyHistogram[b] != 0)
+                highestBucket = (std::max)(highestBucket, b);
+        }
+    }
+    CORE_CHECK(executed == Children * 4 + 4);
+    CORE_CHECK(recorded == executed);
+    // 어떤 대기 시간도 테스트 전체 경과 시간보다 길 수 없다 (구간 b 의 하한은 2^(b-1) 마이크로초)
+    CORE_CHECK(highestBucket == 0 || (uint64_t{ 1 } << (highestBucket - 1)) <= elapsedUs);
+}
@@ -0,0 +1,18 @@
+﻿#include <cstdio>
+
+#include "Test.hpp"
+
+int main()
+{
+    for (const test::TestCase& tc : test::GetRegistry())
+    {
+        const int before = test::GetFailureCount();
+        tc.fn();
+        std::printf("[%s] %s\n", test::GetFailureCount() == before ? "PASS" : "FAIL", tc.name);
+        std::fflush(stdout);
+    }
+
+    const int failures = test::GetFailureCount();
+    std::printf("%zu tests, %d failed checks\n", test::GetRegistry().size(), failures);
+    return failures == 0 ? 0 : 1;
+}